@@ -0,0 +1,68 @@
+#pragma once
+
+#include <vector>
+
+#if defined(__linux__)
+#include <sched.h>
+#endif
+
+namespace corobench {
+
+// CPUs the calling thread may run on, in ascending order. Empty where
+// affinity is not supported.
+inline std::vector<int> allowed_cpus() {
+  std::vector<int> cpus;
+#if defined(__linux__)
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  if (sched_getaffinity(0, sizeof(set), &set) == 0) {
+    for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+      if (CPU_ISSET(cpu, &set)) {
+        cpus.push_back(cpu);
+      }
+    }
+  }
+#endif
+  return cpus;
+}
+
+// Pins the calling thread to one CPU for the lifetime of the scope and
+// restores the previous mask afterwards. A negative cpu, or a platform
+// without sched_setaffinity, leaves the thread unpinned.
+class pin_scope {
+public:
+  explicit pin_scope(int cpu) {
+#if defined(__linux__)
+    if (cpu < 0 || sched_getaffinity(0, sizeof(previous), &previous) != 0) {
+      return;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    active = sched_setaffinity(0, sizeof(set), &set) == 0;
+#else
+    (void)cpu;
+#endif
+  }
+
+  ~pin_scope() {
+#if defined(__linux__)
+    if (active) {
+      sched_setaffinity(0, sizeof(previous), &previous);
+    }
+#endif
+  }
+
+  pin_scope(const pin_scope &) = delete;
+  pin_scope &operator=(const pin_scope &) = delete;
+
+  bool pinned() const noexcept { return active; }
+
+private:
+#if defined(__linux__)
+  cpu_set_t previous;
+#endif
+  bool active = false;
+};
+
+} // namespace corobench
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <new>
+
+namespace corobench {
+
+// Bump allocator over a caller-owned buffer.
+// Individual deallocations are no-ops; everything handed out is released at
+// once by reset(). Exhausting the buffer throws std::bad_alloc rather than
+// silently falling back to the heap.
+class monotonic_arena {
+public:
+  monotonic_arena(void *buffer, std::size_t size) noexcept
+      : begin(static_cast<std::byte *>(buffer)), current(begin),
+        capacity(size), remaining(size) {}
+
+  template <std::size_t N>
+  explicit monotonic_arena(std::byte (&buffer)[N]) noexcept
+      : monotonic_arena(buffer, N) {}
+
+  monotonic_arena(const monotonic_arena &) = delete;
+  monotonic_arena &operator=(const monotonic_arena &) = delete;
+
+  void *allocate(std::size_t size,
+                 std::size_t align = alignof(std::max_align_t)) {
+    void *ptr = current;
+    if (!std::align(align, size, ptr, remaining)) {
+      throw std::bad_alloc();
+    }
+    current = static_cast<std::byte *>(ptr) + size;
+    remaining -= size;
+    return ptr;
+  }
+
+  void reset() noexcept {
+    current = begin;
+    remaining = capacity;
+  }
+
+  std::size_t used() const noexcept { return capacity - remaining; }
+
+private:
+  std::byte *begin;
+  std::byte *current;
+  std::size_t capacity;
+  std::size_t remaining;
+};
+
+// Standard allocator adaptor over monotonic_arena, suitable for passing
+// through std::allocator_arg_t. Every block is max_align_t aligned so it can
+// hold a coroutine frame.
+template <typename T> class arena_allocator {
+public:
+  using value_type = T;
+
+  explicit arena_allocator(monotonic_arena &arena) noexcept : arena(&arena) {}
+
+  template <typename U>
+  arena_allocator(const arena_allocator<U> &other) noexcept
+      : arena(other.arena) {}
+
+  T *allocate(std::size_t n) {
+    return static_cast<T *>(arena->allocate(n * sizeof(T)));
+  }
+
+  void deallocate(T *, std::size_t) noexcept {}
+
+  template <typename U>
+  bool operator==(const arena_allocator<U> &other) const noexcept {
+    return arena == other.arena;
+  }
+
+private:
+  template <typename U> friend class arena_allocator;
+
+  monotonic_arena *arena;
+};
+
+} // namespace corobench
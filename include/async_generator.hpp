@@ -0,0 +1,170 @@
+#pragma once
+
+#include <algorithm>
+#include <coroutine>
+#include <cstddef>
+#include <frame_stats.hpp>
+#include <span>
+#include <vector>
+
+namespace async_coro_lazy {
+
+// Lazy stream of T. The generator yields either one item (`co_yield value`)
+// or a whole batch (`co_yield std::span<const T>(...)`), and the consumer
+// pulls items one at a time:
+//
+//   for (;;) {
+//     const T *item = co_await gen.next();
+//     if (!item) break;
+//     ...
+//   }
+//
+// (C++20 has no `for co_await`.) Control passes between the two coroutines
+// by symmetric transfer. While the current batch still holds items, next()
+// does not suspend at all and only advances a pointer. A yield costs two
+// transfers however many items it carries, so batching spreads that cost
+// over the batch.
+//
+// Items point into the generator's frame or the yielded span, and stay valid
+// until the next call to next(). Single-threaded.
+template <typename T> class async_generator {
+public:
+  struct promise_type {
+    const T *cursor = nullptr;
+    const T *end = nullptr;
+    std::coroutine_handle<> consumer;
+
+    // Frame allocation goes through the size recorder (see frame_stats.hpp)
+    static void *operator new(std::size_t size) {
+      corobench::frame_stats::record(size);
+      return ::operator new(size);
+    }
+
+    static void operator delete(void *ptr, std::size_t size) noexcept {
+      ::operator delete(ptr, size);
+    }
+
+    async_generator get_return_object() {
+      return async_generator{
+          std::coroutine_handle<promise_type>::from_promise(*this)};
+    }
+
+    // Runs only once the consumer asks for the first item
+    std::suspend_always initial_suspend() noexcept { return {}; }
+
+    // Hands control back to the consumer - no stack growth
+    struct yield_awaiter {
+      bool skip = false;
+
+      bool await_ready() const noexcept { return skip; }
+
+      std::coroutine_handle<>
+      await_suspend(std::coroutine_handle<promise_type> h) noexcept {
+        return h.promise().consumer;
+      }
+
+      void await_resume() const noexcept {}
+    };
+
+    // The yielded object outlives the suspension, so pointing at it is safe
+    yield_awaiter yield_value(const T &value) noexcept {
+      cursor = &value;
+      end = cursor + 1;
+      return {};
+    }
+
+    // An empty batch does not suspend, since the consumer would take it
+    // for the end of the stream
+    yield_awaiter yield_value(std::span<const T> batch) noexcept {
+      cursor = batch.data();
+      end = cursor + batch.size();
+      return {batch.empty()};
+    }
+
+    yield_awaiter final_suspend() noexcept {
+      cursor = end = nullptr;
+      return {};
+    }
+
+    void return_void() noexcept {}
+
+    // No exception handling for performance
+    void unhandled_exception() noexcept {}
+  };
+
+  explicit async_generator(std::coroutine_handle<promise_type> h) noexcept
+      : handle(h) {}
+
+  async_generator(async_generator &&other) noexcept : handle(other.handle) {
+    other.handle = nullptr;
+  }
+
+  async_generator &operator=(async_generator &&other) noexcept {
+    if (this != &other) {
+      if (handle) {
+        handle.destroy();
+      }
+      handle = other.handle;
+      other.handle = nullptr;
+    }
+    return *this;
+  }
+
+  ~async_generator() {
+    if (handle) {
+      handle.destroy();
+    }
+  }
+
+  async_generator(const async_generator &) = delete;
+  async_generator &operator=(const async_generator &) = delete;
+
+  struct next_awaiter {
+    std::coroutine_handle<promise_type> handle;
+
+    // Ready while the current batch has items left, or once finished
+    bool await_ready() const noexcept {
+      const promise_type &promise = handle.promise();
+      return promise.cursor != promise.end || handle.done();
+    }
+
+    std::coroutine_handle<>
+    await_suspend(std::coroutine_handle<> awaiting) noexcept {
+      handle.promise().consumer = awaiting;
+      return handle; // Symmetric transfer - no stack growth
+    }
+
+    // The next item, or nullptr once the generator has returned
+    const T *await_resume() noexcept {
+      promise_type &promise = handle.promise();
+      return promise.cursor != promise.end ? promise.cursor++ : nullptr;
+    }
+  };
+
+  next_awaiter next() noexcept { return next_awaiter{handle}; }
+
+private:
+  std::coroutine_handle<promise_type> handle;
+};
+
+// Streams 0, 1, ..., count - 1 one item per co_yield
+async_generator<int> async_stream(int count) {
+  for (int i = 0; i < count; ++i) {
+    co_yield i;
+  }
+}
+
+// Same items, co_yielded `batch` at a time from a buffer in the frame
+async_generator<int> async_stream(int count, int batch) {
+  batch = std::max(batch, 1);
+  std::vector<int> buffer(static_cast<std::size_t>(batch));
+  for (int first = 0; first < count; first += batch) {
+    int n = std::min(batch, count - first);
+    for (int i = 0; i < n; ++i) {
+      buffer[static_cast<std::size_t>(i)] = first + i;
+    }
+    co_yield std::span<const int>(buffer.data(), static_cast<std::size_t>(n));
+  }
+}
+
+} // namespace async_coro_lazy
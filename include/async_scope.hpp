@@ -0,0 +1,82 @@
+#pragma once
+
+#include <atomic>
+#include <coroutine>
+#include <coroutine_atomic.hpp>
+#include <cstddef>
+
+namespace async_coro_atomic {
+
+// Tracks detached tasks so their owner can wait for all of them.
+// spawn(task) takes over the task's frame and installs the scope's
+// join_counter as its continuation, in detached mode: the child destroys its
+// own frame when it finishes and then counts down. The only bookkeeping is
+// the one counter, so spawning costs no allocation beyond the task's frame.
+//
+// The counter holds the live children plus one share for the scope itself.
+// co_await join() gives that share up and resumes once the last child is
+// gone, then takes it back so the scope can be reused. Children may spawn
+// siblings while a join is pending, since each of them holds a count.
+// The scope must be joined before it is destroyed.
+class async_scope {
+public:
+  async_scope() noexcept {
+    join_state.remaining.store(1, std::memory_order_relaxed);
+    join_state.detached = true;
+  }
+
+  async_scope(const async_scope &) = delete;
+  async_scope &operator=(const async_scope &) = delete;
+
+  // Children still running
+  std::size_t size() const noexcept {
+    return join_state.remaining.load(std::memory_order_relaxed) - 1;
+  }
+
+  template <typename T, typename Frames>
+  void spawn(basic_task<T, Frames> task) noexcept {
+    auto handle = task.release();
+    auto &promise = handle.promise();
+    if (promise.finished()) {
+      handle.destroy();
+      return;
+    }
+    join_state.remaining.fetch_add(1, std::memory_order_relaxed);
+    void *previous = promise.state.exchange(join_state.tagged(),
+                                            std::memory_order_acq_rel);
+    if (previous == &promise) {
+      // Finished in the meantime and will not count down
+      handle.destroy();
+      join_state.remaining.fetch_sub(1, std::memory_order_relaxed);
+    }
+  }
+
+  struct join_awaiter {
+    async_scope &scope;
+
+    bool await_ready() const noexcept {
+      return scope.join_state.remaining.load(std::memory_order_acquire) == 1;
+    }
+
+    bool await_suspend(std::coroutine_handle<> parent) noexcept {
+      scope.join_state.continuation = parent;
+      return scope.join_state.remaining.fetch_sub(
+                 1, std::memory_order_acq_rel) != 1;
+    }
+
+    // Takes the scope's share back, unless await_ready skipped giving it up
+    void await_resume() const noexcept {
+      if (scope.join_state.continuation) {
+        scope.join_state.continuation = nullptr;
+        scope.join_state.remaining.store(1, std::memory_order_relaxed);
+      }
+    }
+  };
+
+  join_awaiter join() noexcept { return {*this}; }
+
+private:
+  join_counter join_state{};
+};
+
+} // namespace async_coro_atomic
@@ -1,6 +1,11 @@
 #pragma once
 
+#include <atomic>
+#include <cstddef>
 #include <functional>
+#include <stop_token>
+#include <utility>
+#include <vector>
 
 namespace async_callback {
 
@@ -38,4 +43,162 @@ void async_complex_chain(int x, Callback<T> final_callback) {
   });
 }
 
+// Posted variants: every step is queued on the executor and runs from its
+// run loop rather than inline
+template <typename T, typename Executor>
+void async_compute(Executor &executor, int x, Callback<T> callback) {
+  executor.post([x, callback = std::move(callback)]() mutable {
+    async_compute<T>(x, std::move(callback));
+  });
+}
+
+template <typename T, typename Executor>
+void async_chain(Executor &executor, int x, Callback<T> final_callback) {
+  async_compute<T>(executor, x, [&executor, final_callback](T result1) {
+    async_compute<T>(executor, result1 % 100,
+                     [result1, final_callback](T result2) {
+                       final_callback(result1 + result2);
+                     });
+  });
+}
+
+template <typename T, typename Executor>
+void async_complex_chain(Executor &executor, int x,
+                         Callback<T> final_callback) {
+  async_compute<T>(executor, x, [&executor, final_callback](T v1) {
+    async_compute<T>(executor, v1 % 100, [&executor, v1, final_callback](T v2) {
+      async_compute<T>(executor, v2 % 50, [v1, v2, final_callback](T v3) {
+        final_callback(v1 + v2 + v3);
+      });
+    });
+  });
+}
+
+// Fan-out with a countdown-latch join: `count` posted computations share one
+// allocated latch holding the remaining count and the running sum, and the
+// one that finishes last calls final_callback with the sum
+template <typename T, typename Executor>
+void async_fan_out(Executor &executor, int count, int x,
+                   Callback<T> final_callback) {
+  if (count <= 0) {
+    final_callback(T{});
+    return;
+  }
+
+  struct latch {
+    std::atomic<int> remaining;
+    std::atomic<T> sum;
+    Callback<T> done;
+  };
+  auto *join = new latch{count, T{}, std::move(final_callback)};
+  for (int i = 0; i < count; ++i) {
+    async_compute<T>(executor, x, [join](T val) {
+      join->sum.fetch_add(val, std::memory_order_relaxed);
+      if (join->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        join->done(join->sum.load(std::memory_order_relaxed));
+        delete join;
+      }
+    });
+  }
+}
+
+// First-result race with cancellation: computation i runs workloads[i]
+// iterations on the executor and stops early once a result is in. The first
+// to finish passes its result to first_callback and requests stop; the last
+// one to finish, winner or not, calls drained_callback and frees the single
+// shared allocation.
+template <typename T, typename Executor>
+void async_when_any(Executor &executor, const std::vector<int> &workloads,
+                    Callback<T> first_callback,
+                    std::function<void()> drained_callback) {
+  if (workloads.empty()) {
+    drained_callback();
+    return;
+  }
+
+  struct race {
+    std::atomic<std::size_t> remaining;
+    std::stop_source stop;
+    Callback<T> first;
+    std::function<void()> drained;
+  };
+  auto *state = new race{workloads.size(), {}, std::move(first_callback),
+                         std::move(drained_callback)};
+  for (int x : workloads) {
+    executor.post([state, x] {
+      volatile T result = 0;
+      for (int i = 0; i < x && !state->stop.stop_requested(); i = i + 1) {
+        volatile T temp = i * 31 + (i & 1);
+        result += temp;
+      }
+      if (state->stop.request_stop()) {
+        state->first(static_cast<T>(result));
+      }
+      if (state->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        state->drained();
+        delete state;
+      }
+    });
+  }
+}
+
+// Streams 0, 1, ..., count - 1 to on_next, one call per item, then calls
+// on_done
+template <typename T>
+void async_stream(int count, Callback<T> on_next,
+                  std::function<void()> on_done) {
+  for (int i = 0; i < count; ++i) {
+    on_next(static_cast<T>(i));
+  }
+  on_done();
+}
+
+// Callback counterpart of async_coro_atomic::async_scope. spawn() posts a
+// job that runs f and then counts down; join(callback) runs callback once
+// every spawned job has finished. Like the coroutine scope it keeps a single
+// counter, which holds one share for the scope itself, and can be reused
+// after the join callback has run.
+class async_scope {
+public:
+  template <typename F> struct job {
+    async_scope *scope;
+    F fn;
+
+    void operator()() {
+      fn();
+      scope->arrive();
+    }
+  };
+
+  async_scope() = default;
+  async_scope(const async_scope &) = delete;
+  async_scope &operator=(const async_scope &) = delete;
+
+  std::size_t size() const noexcept {
+    return remaining.load(std::memory_order_relaxed) - 1;
+  }
+
+  template <typename Executor, typename F> void spawn(Executor &executor, F f) {
+    remaining.fetch_add(1, std::memory_order_relaxed);
+    executor.post(job<F>{this, std::move(f)});
+  }
+
+  void join(std::function<void()> callback) {
+    on_join = std::move(callback);
+    arrive();
+  }
+
+private:
+  void arrive() {
+    if (remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      std::function<void()> callback = std::move(on_join);
+      remaining.store(1, std::memory_order_relaxed);
+      callback();
+    }
+  }
+
+  std::atomic<std::size_t> remaining{1};
+  std::function<void()> on_join;
+};
+
 } // namespace async_callback
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <function_ref.hpp>
+
+namespace async_callback_ref {
+
+// Non-owning callbacks: each level refers to the caller's lambda, so nothing
+// is copied or allocated. Only valid because every step completes before the
+// call that created it returns.
+template <typename T> using Callback = corobench::function_ref<void(T)>;
+
+template <typename T> void async_compute(int x, Callback<T> callback) {
+  volatile T result = 0;
+  for (int i = 0; i < x; i = i + 1) {
+    volatile T temp = i * 31 + (i & 1);
+    result += temp;
+  }
+  callback(static_cast<T>(result));
+}
+
+template <typename T> void async_chain(int x, Callback<T> final_callback) {
+  async_compute<T>(x, [final_callback](T result1) {
+    async_compute<T>(result1 % 100, [result1, final_callback](T result2) {
+      final_callback(result1 + result2);
+    });
+  });
+}
+
+template <typename T>
+void async_complex_chain(int x, Callback<T> final_callback) {
+  async_compute<T>(x, [final_callback](T v1) {
+    async_compute<T>(v1 % 100, [v1, final_callback](T v2) {
+      async_compute<T>(v2 % 50, [v1, v2, final_callback](T v3) {
+        final_callback(v1 + v2 + v3);
+      });
+    });
+  });
+}
+
+} // namespace async_callback_ref
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+#include <inplace_function.hpp>
+#include <type_traits>
+#include <utility>
+
+namespace async_callback_inplace {
+
+inline constexpr std::size_t default_capacity = 32;
+
+// Fixed-capacity owning callbacks. Each nested lambda captures the callback
+// of the level above, so every level sizes its storage to the exact lambda
+// it wraps instead of sharing one worst-case capacity. Parameters use
+// std::type_identity_t so a lambda argument converts to the explicit or
+// default capacity instead of failing deduction.
+template <typename T, std::size_t Capacity = default_capacity>
+using Callback = corobench::inplace_function<void(T), Capacity>;
+
+template <typename T, std::size_t Capacity = default_capacity>
+void async_compute(int x,
+                   std::type_identity_t<Callback<T, Capacity>> callback) {
+  volatile T result = 0;
+  for (int i = 0; i < x; i = i + 1) {
+    volatile T temp = i * 31 + (i & 1);
+    result += temp;
+  }
+  callback(static_cast<T>(result));
+}
+
+template <typename T, std::size_t Capacity = default_capacity>
+void async_chain(int x,
+                 std::type_identity_t<Callback<T, Capacity>> final_callback) {
+  auto on_first = [final_callback](T result1) {
+    auto on_second = [result1, final_callback](T result2) {
+      final_callback(result1 + result2);
+    };
+    async_compute<T, sizeof(on_second)>(result1 % 100, std::move(on_second));
+  };
+  async_compute<T, sizeof(on_first)>(x, std::move(on_first));
+}
+
+template <typename T, std::size_t Capacity = default_capacity>
+void async_complex_chain(
+    int x, std::type_identity_t<Callback<T, Capacity>> final_callback) {
+  auto on_first = [final_callback](T v1) {
+    auto on_second = [v1, final_callback](T v2) {
+      auto on_third = [v1, v2, final_callback](T v3) {
+        final_callback(v1 + v2 + v3);
+      };
+      async_compute<T, sizeof(on_third)>(v2 % 50, std::move(on_third));
+    };
+    async_compute<T, sizeof(on_second)>(v1 % 100, std::move(on_second));
+  };
+  async_compute<T, sizeof(on_first)>(x, std::move(on_first));
+}
+
+} // namespace async_callback_inplace
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <functional>
+#include <utility>
+
+namespace async_callback_move_only {
+
+// std::move_only_function (C++23): continuations are moved down the pyramid
+// instead of being copied at every level
+template <typename T> using Callback = std::move_only_function<void(T)>;
+
+template <typename T> void async_compute(int x, Callback<T> callback) {
+  volatile T result = 0;
+  for (int i = 0; i < x; i = i + 1) {
+    volatile T temp = i * 31 + (i & 1);
+    result += temp;
+  }
+  callback(static_cast<T>(result));
+}
+
+template <typename T> void async_chain(int x, Callback<T> final_callback) {
+  async_compute<T>(x, [final_callback = std::move(final_callback)](
+                          T result1) mutable {
+    async_compute<T>(result1 % 100,
+                     [result1, final_callback = std::move(final_callback)](
+                         T result2) mutable {
+                       final_callback(result1 + result2);
+                     });
+  });
+}
+
+template <typename T>
+void async_complex_chain(int x, Callback<T> final_callback) {
+  async_compute<T>(x, [final_callback =
+                           std::move(final_callback)](T v1) mutable {
+    async_compute<T>(v1 % 100, [v1, final_callback = std::move(
+                                        final_callback)](T v2) mutable {
+      async_compute<T>(v2 % 50, [v1, v2, final_callback = std::move(
+                                             final_callback)](T v3) mutable {
+        final_callback(v1 + v2 + v3);
+      });
+    });
+  });
+}
+
+} // namespace async_callback_move_only
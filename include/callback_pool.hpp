@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <work_stealing_pool.hpp>
+
+namespace corobench {
+
+// Intrusive queue node for callback work. The pool queues only the pointer;
+// the callable lives in the same allocation right behind the node.
+struct work_item {
+  void (*run)(work_item *) noexcept;
+};
+
+inline void execute(work_item *item) { item->run(item); }
+
+// Callback counterpart of work_stealing_pool, with the same deques, injection
+// queue and stealing. post(f) makes one allocation holding the node and f,
+// and frees it right after f runs on a worker.
+class callback_pool : public basic_work_stealing_pool<work_item *> {
+public:
+  using basic_work_stealing_pool::basic_work_stealing_pool;
+
+  template <typename F> void post(F &&f) {
+    submit(new node<std::decay_t<F>>(std::forward<F>(f)));
+  }
+
+  // Size of the allocation post(f) makes for a callable of type F
+  template <typename F> static constexpr std::size_t post_size() noexcept {
+    return sizeof(node<std::decay_t<F>>);
+  }
+
+private:
+  template <typename F> struct node : work_item {
+    explicit node(F &&f) : work_item{&invoke}, fn(std::move(f)) {}
+    explicit node(const F &f) : work_item{&invoke}, fn(f) {}
+
+    static void invoke(work_item *item) noexcept {
+      auto *self = static_cast<node *>(item);
+      self->fn();
+      delete self;
+    }
+
+    F fn;
+  };
+};
+
+} // namespace corobench
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <utility>
+
+namespace async_callback_static {
+
+// Continuation-passing style with no type erasure at all: every function is
+// templated on the continuation type, so the compiler sees the whole pyramid
+// and can inline it. This is the lower bound for any async style here.
+template <typename T, typename F> void async_compute(int x, F &&callback) {
+  volatile T result = 0;
+  for (int i = 0; i < x; i = i + 1) {
+    volatile T temp = i * 31 + (i & 1);
+    result += temp;
+  }
+  std::forward<F>(callback)(static_cast<T>(result));
+}
+
+template <typename T, typename F> void async_chain(int x, F &&final_callback) {
+  async_compute<T>(x, [final_callback = std::forward<F>(final_callback)](
+                          T result1) {
+    async_compute<T>(result1 % 100, [result1, final_callback](T result2) {
+      final_callback(result1 + result2);
+    });
+  });
+}
+
+template <typename T, typename F>
+void async_complex_chain(int x, F &&final_callback) {
+  async_compute<T>(x, [final_callback =
+                           std::forward<F>(final_callback)](T v1) {
+    async_compute<T>(v1 % 100, [v1, final_callback](T v2) {
+      async_compute<T>(v2 % 50, [v1, v2, final_callback](T v3) {
+        final_callback(v1 + v2 + v3);
+      });
+    });
+  });
+}
+
+} // namespace async_callback_static
@@ -0,0 +1,131 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+namespace corobench {
+
+// Chase-Lev work-stealing deque (Le, Pop, Cohen, Zappa Nardelli, PPoPP'13).
+// The owning thread pushes and pops at the bottom (LIFO); any other thread
+// steals from the top (FIFO). The ring grows on demand; replaced rings are
+// kept until the deque is destroyed so a concurrent thief never reads freed
+// memory.
+template <typename T> class chase_lev_deque {
+  static_assert(std::is_trivially_copyable_v<T>,
+                "chase_lev_deque stores items in atomics");
+
+public:
+  explicit chase_lev_deque(std::size_t capacity = 256)
+      : ring(new buffer(capacity)) {
+    rings.emplace_back(ring.load(std::memory_order_relaxed));
+  }
+
+  chase_lev_deque(const chase_lev_deque &) = delete;
+  chase_lev_deque &operator=(const chase_lev_deque &) = delete;
+
+  // Owner only
+  void push(T item) {
+    std::int64_t b = bottom.load(std::memory_order_relaxed);
+    std::int64_t t = top.load(std::memory_order_acquire);
+    buffer *a = ring.load(std::memory_order_relaxed);
+    if (b - t > static_cast<std::int64_t>(a->capacity) - 1) {
+      a = grow(a, t, b);
+    }
+    a->store(b, item);
+    // A release store rather than the paper's release fence: same code on
+    // x86, and visible to ThreadSanitizer
+    bottom.store(b + 1, std::memory_order_release);
+  }
+
+  // Owner only
+  std::optional<T> pop() {
+    std::int64_t b = bottom.load(std::memory_order_relaxed) - 1;
+    buffer *a = ring.load(std::memory_order_relaxed);
+    bottom.store(b, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::int64_t t = top.load(std::memory_order_relaxed);
+
+    if (t > b) {
+      bottom.store(b + 1, std::memory_order_relaxed);
+      return std::nullopt;
+    }
+
+    T item = a->load(b);
+    if (t == b) {
+      // Last item: race against thieves for it
+      bool won = top.compare_exchange_strong(t, t + 1,
+                                             std::memory_order_seq_cst,
+                                             std::memory_order_relaxed);
+      bottom.store(b + 1, std::memory_order_relaxed);
+      if (!won) {
+        return std::nullopt;
+      }
+    }
+    return item;
+  }
+
+  // Any thread
+  std::optional<T> steal() {
+    std::int64_t t = top.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    std::int64_t b = bottom.load(std::memory_order_acquire);
+    if (t >= b) {
+      return std::nullopt;
+    }
+
+    buffer *a = ring.load(std::memory_order_acquire);
+    T item = a->load(t);
+    if (!top.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                     std::memory_order_relaxed)) {
+      return std::nullopt;
+    }
+    return item;
+  }
+
+  // Approximate; only used as a hint by idle workers
+  bool empty() const noexcept {
+    return bottom.load(std::memory_order_relaxed) <=
+           top.load(std::memory_order_relaxed);
+  }
+
+private:
+  struct buffer {
+    explicit buffer(std::size_t capacity)
+        : capacity(capacity), slots(new std::atomic<T>[capacity]) {}
+
+    T load(std::int64_t i) const noexcept {
+      return slots[static_cast<std::size_t>(i) & (capacity - 1)].load(
+          std::memory_order_relaxed);
+    }
+
+    void store(std::int64_t i, T item) noexcept {
+      slots[static_cast<std::size_t>(i) & (capacity - 1)].store(
+          item, std::memory_order_relaxed);
+    }
+
+    std::size_t capacity; // Always a power of two
+    std::unique_ptr<std::atomic<T>[]> slots;
+  };
+
+  buffer *grow(buffer *old, std::int64_t t, std::int64_t b) {
+    auto *bigger = new buffer(old->capacity * 2);
+    for (std::int64_t i = t; i < b; ++i) {
+      bigger->store(i, old->load(i));
+    }
+    rings.emplace_back(bigger);
+    ring.store(bigger, std::memory_order_release);
+    return bigger;
+  }
+
+  alignas(64) std::atomic<std::int64_t> top{0};
+  alignas(64) std::atomic<std::int64_t> bottom{0};
+  std::atomic<buffer *> ring;
+  std::vector<std::unique_ptr<buffer>> rings; // Owner only
+};
+
+} // namespace corobench
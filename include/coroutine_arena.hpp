@@ -0,0 +1,193 @@
+#pragma once
+
+#include <coroutine>
+#include <cstddef>
+#include <frame_stats.hpp>
+#include <memory>
+#include <new>
+
+namespace async_coro_arena {
+
+namespace detail {
+
+// Frame layout: [ coroutine frame | dealloc fn | allocator copy ]
+// The deallocation function is stored at an offset that depends only on the
+// frame size, so promise_type::operator delete can find it without knowing
+// which allocator the frame was created with.
+using dealloc_fn = void (*)(void *, std::size_t) noexcept;
+
+constexpr std::size_t align_up(std::size_t n, std::size_t align) noexcept {
+  return (n + align - 1) & ~(align - 1);
+}
+
+constexpr std::size_t dealloc_offset(std::size_t size) noexcept {
+  return align_up(size, alignof(dealloc_fn));
+}
+
+template <typename Alloc> struct frame_allocator {
+  using byte_alloc = typename std::allocator_traits<
+      Alloc>::template rebind_alloc<std::byte>;
+  using traits = std::allocator_traits<byte_alloc>;
+
+  static constexpr std::size_t alloc_offset(std::size_t size) noexcept {
+    return align_up(dealloc_offset(size) + sizeof(dealloc_fn),
+                    alignof(byte_alloc));
+  }
+
+  static constexpr std::size_t total_size(std::size_t size) noexcept {
+    return alloc_offset(size) + sizeof(byte_alloc);
+  }
+
+  static void *allocate(std::size_t size, const Alloc &alloc) {
+    byte_alloc a(alloc);
+    std::byte *frame = traits::allocate(a, total_size(size));
+    ::new (frame + dealloc_offset(size)) dealloc_fn(&deallocate);
+    ::new (frame + alloc_offset(size)) byte_alloc(std::move(a));
+    return frame;
+  }
+
+  static void deallocate(void *ptr, std::size_t size) noexcept {
+    auto *frame = static_cast<std::byte *>(ptr);
+    auto *stored = std::launder(
+        reinterpret_cast<byte_alloc *>(frame + alloc_offset(size)));
+    byte_alloc a(std::move(*stored));
+    stored->~byte_alloc();
+    traits::deallocate(a, frame, total_size(size));
+  }
+};
+
+} // namespace detail
+
+// Optimized Task whose frame can be allocated from a caller-supplied
+// allocator passed as a leading (std::allocator_arg_t, Alloc) argument
+template <typename T> class task {
+public:
+  struct promise_type {
+    T value;
+
+    // Selected when the coroutine's parameters start with
+    // (std::allocator_arg_t, Alloc)
+    template <typename Alloc, typename... Args>
+    static void *operator new(std::size_t size, std::allocator_arg_t,
+                              const Alloc &alloc, const Args &...) {
+      corobench::frame_stats::record(size);
+      return detail::frame_allocator<Alloc>::allocate(size, alloc);
+    }
+
+    static void *operator new(std::size_t size) {
+      corobench::frame_stats::record(size);
+      return detail::frame_allocator<std::allocator<std::byte>>::allocate(
+          size, std::allocator<std::byte>{});
+    }
+
+    static void operator delete(void *ptr, std::size_t size) noexcept {
+      auto *frame = static_cast<std::byte *>(ptr);
+      auto fn = *std::launder(reinterpret_cast<detail::dealloc_fn *>(
+          frame + detail::dealloc_offset(size)));
+      fn(ptr, size);
+    }
+
+    task get_return_object() {
+      return task{std::coroutine_handle<promise_type>::from_promise(*this)};
+    }
+
+    // Eager execution - no suspension at start
+    std::suspend_never initial_suspend() noexcept { return {}; }
+
+    // Suspend at end to preserve value
+    std::suspend_always final_suspend() noexcept { return {}; }
+
+    void return_value(T val) noexcept { value = val; }
+
+    // No exception handling for performance
+    void unhandled_exception() noexcept {}
+  };
+
+  explicit task(std::coroutine_handle<promise_type> h) noexcept : handle(h) {}
+
+  task(task &&other) noexcept : handle(other.handle) { other.handle = nullptr; }
+
+  task &operator=(task &&other) noexcept {
+    if (this != &other) {
+      if (handle) {
+        handle.destroy();
+      }
+      handle = other.handle;
+      other.handle = nullptr;
+    }
+    return *this;
+  }
+
+  ~task() {
+    if (handle) {
+      handle.destroy();
+    }
+  }
+
+  task(const task &) = delete;
+  task &operator=(const task &) = delete;
+
+  T get() noexcept { return handle.promise().value; }
+
+  bool done() const noexcept { return handle && handle.done(); }
+
+  // Awaiter for co_await support
+  struct awaiter {
+    std::coroutine_handle<promise_type> handle;
+
+    bool await_ready() const noexcept { return handle.done(); }
+
+    std::coroutine_handle<> await_suspend(std::coroutine_handle<>) noexcept {
+      return handle; // Symmetric transfer - no stack growth
+    }
+
+    T await_resume() noexcept { return handle.promise().value; }
+  };
+
+  awaiter operator co_await() noexcept { return awaiter{handle}; }
+
+private:
+  std::coroutine_handle<promise_type> handle;
+};
+
+// GCC sees the frame allocated through the allocator's ::operator new and
+// released through promise_type::operator delete, and flags the pair even
+// though the stored dealloc fn routes it back to the same allocator
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+// Simple async computation
+template <typename Alloc>
+task<int> async_compute(std::allocator_arg_t, Alloc, int x) {
+  volatile int result = 0;
+  for (int i = 0; i < x; i = i + 1) {
+    volatile int temp = i * 31 + (i & 1);
+    result += temp;
+  }
+  co_return static_cast<int>(result);
+}
+
+// The allocator is forwarded explicitly so every nested frame comes from the
+// same source as the outer one
+template <typename Alloc>
+task<int> async_chain(std::allocator_arg_t, Alloc alloc, int x) {
+  int val1 = co_await async_compute(std::allocator_arg, alloc, x);
+  int val2 = co_await async_compute(std::allocator_arg, alloc, val1 % 100);
+  co_return val1 + val2;
+}
+
+template <typename Alloc>
+task<int> async_complex_chain(std::allocator_arg_t, Alloc alloc, int x) {
+  int v1 = co_await async_compute(std::allocator_arg, alloc, x);
+  int v2 = co_await async_compute(std::allocator_arg, alloc, v1 % 100);
+  int v3 = co_await async_compute(std::allocator_arg, alloc, v2 % 50);
+  co_return v1 + v2 + v3;
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+} // namespace async_coro_arena
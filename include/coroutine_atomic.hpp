@@ -0,0 +1,285 @@
+#pragma once
+
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <frame_stats.hpp>
+#include <stop_token>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace async_coro_atomic {
+
+// Join point shared by several children (see when_all.hpp). Each child that
+// finishes calls `arrive` if set, then counts down; the one that reaches zero
+// resumes `continuation`.
+struct join_counter {
+  std::atomic<std::size_t> remaining;
+  std::coroutine_handle<> continuation;
+  void (*arrive)(join_counter *, void *promise) noexcept = nullptr;
+  // Set by async_scope: children own their frames and destroy them on
+  // finishing, before counting down
+  bool detached = false;
+
+  void *tagged() noexcept {
+    return reinterpret_cast<void *>(reinterpret_cast<std::uintptr_t>(this) |
+                                    1);
+  }
+
+  static join_counter *untag(void *state) noexcept {
+    auto bits = reinterpret_cast<std::uintptr_t>(state);
+    return bits & 1 ? reinterpret_cast<join_counter *>(bits - 1) : nullptr;
+  }
+};
+
+// Eager Task that may complete on a different thread than its awaiter.
+// The awaiter and the child's final_suspend race through a single atomic
+// state word:
+//   nullptr          - running, nobody waiting yet
+//   &promise         - finished
+//   low bit set      - address of a join_counter, plus one
+//   any other value  - address of the awaiting coroutine
+// Whichever side arrives second resumes the parent, so it is resumed exactly
+// once and never lost. Each side does one exchange; an awaiter that finds the
+// child already finished does none.
+//
+// Frames come from `Frames::allocate`/`Frames::deallocate`, the interface of
+// corobench::frame_pool; task<T> uses global operator new.
+template <typename T, typename Frames> class basic_task {
+public:
+  struct promise_type {
+    T value;
+    std::atomic<void *> state{nullptr};
+
+    // Frame allocation goes through the size recorder (see frame_stats.hpp)
+    static void *operator new(std::size_t size) {
+      corobench::frame_stats::record(size);
+      return Frames::allocate(size);
+    }
+
+    static void operator delete(void *ptr, std::size_t size) noexcept {
+      Frames::deallocate(ptr, size);
+    }
+
+    basic_task get_return_object() {
+      return basic_task{
+          std::coroutine_handle<promise_type>::from_promise(*this)};
+    }
+
+    // Eager execution - no suspension at start
+    std::suspend_never initial_suspend() noexcept { return {}; }
+
+    struct final_awaiter {
+      bool await_ready() const noexcept { return false; }
+
+      std::coroutine_handle<>
+      await_suspend(std::coroutine_handle<promise_type> h) noexcept {
+        promise_type &promise = h.promise();
+        void *awaiting =
+            promise.state.exchange(&promise, std::memory_order_acq_rel);
+        // Once the exchange is visible the awaiter may destroy this frame,
+        // so nothing below touches it
+        if (join_counter *join = join_counter::untag(awaiting)) {
+          if (join->arrive) {
+            join->arrive(join, &promise);
+          }
+          if (join->detached) {
+            h.destroy();
+          }
+          if (join->remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            return join->continuation;
+          }
+          return std::noop_coroutine();
+        }
+        if (awaiting) {
+          return std::coroutine_handle<>::from_address(awaiting);
+        }
+        return std::noop_coroutine();
+      }
+
+      void await_resume() const noexcept {}
+    };
+
+    final_awaiter final_suspend() noexcept { return {}; }
+
+    void return_value(T val) noexcept { value = val; }
+
+    // No exception handling for performance
+    void unhandled_exception() noexcept {}
+
+    bool finished() const noexcept {
+      return state.load(std::memory_order_acquire) == this;
+    }
+  };
+
+  explicit basic_task(std::coroutine_handle<promise_type> h) noexcept
+      : handle(h) {}
+
+  basic_task(basic_task &&other) noexcept : handle(other.handle) {
+    other.handle = nullptr;
+  }
+
+  basic_task &operator=(basic_task &&other) noexcept {
+    if (this != &other) {
+      if (handle) {
+        handle.destroy();
+      }
+      handle = other.handle;
+      other.handle = nullptr;
+    }
+    return *this;
+  }
+
+  ~basic_task() {
+    if (handle) {
+      handle.destroy();
+    }
+  }
+
+  basic_task(const basic_task &) = delete;
+  basic_task &operator=(const basic_task &) = delete;
+
+  // Top-level wait: spins until whichever thread runs the task finishes it
+  T get() noexcept {
+    promise_type &promise = handle.promise();
+    while (!promise.finished()) {
+      std::this_thread::yield();
+    }
+    return promise.value;
+  }
+
+  bool done() const noexcept { return handle && handle.promise().finished(); }
+
+  // Completion state for combinators such as when_all
+  promise_type &promise() const noexcept { return handle.promise(); }
+
+  // Hands the frame over to the caller, e.g. to async_scope
+  std::coroutine_handle<promise_type> release() noexcept {
+    return std::exchange(handle, nullptr);
+  }
+
+  // Awaiter for co_await support
+  struct awaiter {
+    std::coroutine_handle<promise_type> handle;
+
+    bool await_ready() const noexcept { return handle.promise().finished(); }
+
+    bool await_suspend(std::coroutine_handle<> awaiting) noexcept {
+      promise_type &promise = handle.promise();
+      void *previous = promise.state.exchange(awaiting.address(),
+                                              std::memory_order_acq_rel);
+      if (previous == &promise) {
+        // Finished in the meantime: restore the marker that get(), done()
+        // and later awaits look for, and resume right away
+        promise.state.store(&promise, std::memory_order_release);
+        return false;
+      }
+      // Otherwise the child's final_suspend now owns resuming us
+      return true;
+    }
+
+    T await_resume() noexcept { return handle.promise().value; }
+  };
+
+  awaiter operator co_await() noexcept { return awaiter{handle}; }
+
+private:
+  std::coroutine_handle<promise_type> handle;
+};
+
+// Frames from global operator new
+struct heap_frames {
+  static void *allocate(std::size_t size) { return ::operator new(size); }
+
+  static void deallocate(void *ptr, std::size_t size) noexcept {
+    ::operator delete(ptr, size);
+  }
+};
+
+template <typename T> using task = basic_task<T, heap_frames>;
+
+// Simple async computation
+task<int> async_compute(int x) {
+  volatile int result = 0;
+  for (int i = 0; i < x; i = i + 1) {
+    volatile int temp = i * 31 + (i & 1);
+    result += temp;
+  }
+  co_return static_cast<int>(result);
+}
+
+task<int> async_chain(int x) {
+  int val1 = co_await async_compute(x);
+  int val2 = co_await async_compute(val1 % 100);
+  co_return val1 + val2;
+}
+
+task<int> async_complex_chain(int x) {
+  int v1 = co_await async_compute(x);
+  int v2 = co_await async_compute(v1 % 100);
+  int v3 = co_await async_compute(v2 % 50);
+  co_return v1 + v2 + v3;
+}
+
+// Same computations, but each async_compute first moves to a thread chosen
+// by the scheduler and completes there
+template <typename Scheduler>
+task<int> async_compute(Scheduler &scheduler, int x) {
+  co_await scheduler.schedule();
+  volatile int result = 0;
+  for (int i = 0; i < x; i = i + 1) {
+    volatile int temp = i * 31 + (i & 1);
+    result += temp;
+  }
+  co_return static_cast<int>(result);
+}
+
+// Cancellable variant: returns the partial result as soon as `stop` is
+// requested, which costs one load per iteration
+template <typename Scheduler>
+task<int> async_compute(Scheduler &scheduler, int x, std::stop_token stop) {
+  co_await scheduler.schedule();
+  volatile int result = 0;
+  for (int i = 0; i < x && !stop.stop_requested(); i = i + 1) {
+    volatile int temp = i * 31 + (i & 1);
+    result += temp;
+  }
+  co_return static_cast<int>(result);
+}
+
+template <typename Scheduler>
+task<int> async_chain(Scheduler &scheduler, int x) {
+  int val1 = co_await async_compute(scheduler, x);
+  int val2 = co_await async_compute(scheduler, val1 % 100);
+  co_return val1 + val2;
+}
+
+template <typename Scheduler>
+task<int> async_complex_chain(Scheduler &scheduler, int x) {
+  int v1 = co_await async_compute(scheduler, x);
+  int v2 = co_await async_compute(scheduler, v1 % 100);
+  int v3 = co_await async_compute(scheduler, v2 % 50);
+  co_return v1 + v2 + v3;
+}
+
+// Starts `count` independent computations before awaiting any of them, so a
+// work-stealing scheduler can spread them across its workers
+template <typename Scheduler>
+task<int> async_fan_out(Scheduler &scheduler, int count, int x) {
+  co_await scheduler.schedule();
+  std::vector<task<int>> children;
+  children.reserve(static_cast<std::size_t>(count));
+  for (int i = 0; i < count; ++i) {
+    children.push_back(async_compute(scheduler, x));
+  }
+  // Wraps instead of overflowing once many results are added up
+  unsigned sum = 0;
+  for (auto &child : children) {
+    sum += static_cast<unsigned>(co_await child);
+  }
+  co_return static_cast<int>(sum);
+}
+
+} // namespace async_coro_atomic
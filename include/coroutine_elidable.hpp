@@ -1,6 +1,8 @@
 #pragma once
 
 #include <coroutine>
+#include <cstddef>
+#include <frame_stats.hpp>
 #include <optional>
 #include <stdexcept>
 
@@ -12,6 +14,16 @@ public:
     std::optional<T> value;
     std::exception_ptr exception;
 
+    // Frame allocation goes through the size recorder (see frame_stats.hpp)
+    static void *operator new(std::size_t size) {
+      corobench::frame_stats::record(size);
+      return ::operator new(size);
+    }
+
+    static void operator delete(void *ptr, std::size_t size) noexcept {
+      ::operator delete(ptr, size);
+    }
+
     task get_return_object() {
       return task{std::coroutine_handle<promise_type>::from_promise(*this)};
     }
@@ -0,0 +1,163 @@
+#pragma once
+
+#include <coroutine>
+#include <cstddef>
+#include <frame_stats.hpp>
+
+namespace async_coro_lazy {
+
+// Lazy Task: starts suspended, records who awaits it and resumes that
+// coroutine from final_suspend. Unlike the eager variants, a child that
+// really suspends (on an executor, I/O, ...) still resumes its parent.
+template <typename T> class task {
+public:
+  struct promise_type {
+    T value;
+    std::coroutine_handle<> continuation;
+
+    // Frame allocation goes through the size recorder (see frame_stats.hpp)
+    static void *operator new(std::size_t size) {
+      corobench::frame_stats::record(size);
+      return ::operator new(size);
+    }
+
+    static void operator delete(void *ptr, std::size_t size) noexcept {
+      ::operator delete(ptr, size);
+    }
+
+    task get_return_object() {
+      return task{std::coroutine_handle<promise_type>::from_promise(*this)};
+    }
+
+    // Lazy execution - the body runs only once awaited or started
+    std::suspend_always initial_suspend() noexcept { return {}; }
+
+    // Transfers control to the awaiting coroutine - no stack growth
+    struct final_awaiter {
+      bool await_ready() const noexcept { return false; }
+
+      std::coroutine_handle<>
+      await_suspend(std::coroutine_handle<promise_type> h) noexcept {
+        if (std::coroutine_handle<> next = h.promise().continuation) {
+          return next;
+        }
+        return std::noop_coroutine();
+      }
+
+      void await_resume() const noexcept {}
+    };
+
+    final_awaiter final_suspend() noexcept { return {}; }
+
+    void return_value(T val) noexcept { value = val; }
+
+    // No exception handling for performance
+    void unhandled_exception() noexcept {}
+  };
+
+  explicit task(std::coroutine_handle<promise_type> h) noexcept : handle(h) {}
+
+  task(task &&other) noexcept : handle(other.handle) { other.handle = nullptr; }
+
+  task &operator=(task &&other) noexcept {
+    if (this != &other) {
+      if (handle) {
+        handle.destroy();
+      }
+      handle = other.handle;
+      other.handle = nullptr;
+    }
+    return *this;
+  }
+
+  ~task() {
+    if (handle) {
+      handle.destroy();
+    }
+  }
+
+  task(const task &) = delete;
+  task &operator=(const task &) = delete;
+
+  // Runs a top-level task from its initial suspend point. Control returns
+  // here when it completes or first suspends on something external.
+  void start() noexcept { handle.resume(); }
+
+  T get() noexcept { return handle.promise().value; }
+
+  bool done() const noexcept { return handle && handle.done(); }
+
+  // Awaiter for co_await support
+  struct awaiter {
+    std::coroutine_handle<promise_type> handle;
+
+    // The child has not started yet, so always suspend and start it
+    bool await_ready() const noexcept { return false; }
+
+    std::coroutine_handle<>
+    await_suspend(std::coroutine_handle<> awaiting) noexcept {
+      handle.promise().continuation = awaiting;
+      return handle; // Symmetric transfer - no stack growth
+    }
+
+    T await_resume() noexcept { return handle.promise().value; }
+  };
+
+  awaiter operator co_await() noexcept { return awaiter{handle}; }
+
+private:
+  std::coroutine_handle<promise_type> handle;
+};
+
+// Simple async computation
+task<int> async_compute(int x) {
+  volatile int result = 0;
+  for (int i = 0; i < x; i = i + 1) {
+    volatile int temp = i * 31 + (i & 1);
+    result += temp;
+  }
+  co_return static_cast<int>(result);
+}
+
+task<int> async_chain(int x) {
+  int val1 = co_await async_compute(x);
+  int val2 = co_await async_compute(val1 % 100);
+  co_return val1 + val2;
+}
+
+task<int> async_complex_chain(int x) {
+  int v1 = co_await async_compute(x);
+  int v2 = co_await async_compute(v1 % 100);
+  int v3 = co_await async_compute(v2 % 50);
+  co_return v1 + v2 + v3;
+}
+
+// Same computations, but each async_compute first queues itself on the
+// scheduler and runs when the scheduler resumes it
+template <typename Scheduler>
+task<int> async_compute(Scheduler &scheduler, int x) {
+  co_await scheduler.schedule();
+  volatile int result = 0;
+  for (int i = 0; i < x; i = i + 1) {
+    volatile int temp = i * 31 + (i & 1);
+    result += temp;
+  }
+  co_return static_cast<int>(result);
+}
+
+template <typename Scheduler>
+task<int> async_chain(Scheduler &scheduler, int x) {
+  int val1 = co_await async_compute(scheduler, x);
+  int val2 = co_await async_compute(scheduler, val1 % 100);
+  co_return val1 + val2;
+}
+
+template <typename Scheduler>
+task<int> async_complex_chain(Scheduler &scheduler, int x) {
+  int v1 = co_await async_compute(scheduler, x);
+  int v2 = co_await async_compute(scheduler, v1 % 100);
+  int v3 = co_await async_compute(scheduler, v2 % 50);
+  co_return v1 + v2 + v3;
+}
+
+} // namespace async_coro_lazy
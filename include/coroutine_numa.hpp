@@ -0,0 +1,75 @@
+#pragma once
+
+#include <coroutine_atomic.hpp>
+#include <cstddef>
+#include <numa_frame_pool.hpp>
+#include <vector>
+
+namespace async_coro_numa {
+
+// Thread-safe Task from coroutine_atomic.hpp whose frames come from
+// numa_frame_pool, so a frame lives on the node of the worker that started it
+template <typename T>
+using task = async_coro_atomic::basic_task<T, corobench::numa_frame_pool>;
+
+// Simple async computation
+task<int> async_compute(int x) {
+  volatile int result = 0;
+  for (int i = 0; i < x; i = i + 1) {
+    volatile int temp = i * 31 + (i & 1);
+    result += temp;
+  }
+  co_return static_cast<int>(result);
+}
+
+task<int> async_chain(int x) {
+  int val1 = co_await async_compute(x);
+  int val2 = co_await async_compute(val1 % 100);
+  co_return val1 + val2;
+}
+
+task<int> async_complex_chain(int x) {
+  int v1 = co_await async_compute(x);
+  int v2 = co_await async_compute(v1 % 100);
+  int v3 = co_await async_compute(v2 % 50);
+  co_return v1 + v2 + v3;
+}
+
+// Same computations, each async_compute first moving to a scheduler thread
+template <typename Scheduler>
+task<int> async_compute(Scheduler &scheduler, int x) {
+  co_await scheduler.schedule();
+  volatile int result = 0;
+  for (int i = 0; i < x; i = i + 1) {
+    volatile int temp = i * 31 + (i & 1);
+    result += temp;
+  }
+  co_return static_cast<int>(result);
+}
+
+template <typename Scheduler>
+task<int> async_chain(Scheduler &scheduler, int x) {
+  int val1 = co_await async_compute(scheduler, x);
+  int val2 = co_await async_compute(scheduler, val1 % 100);
+  co_return val1 + val2;
+}
+
+// Starts `count` chains before awaiting any of them. Each chain allocates its
+// frames on whichever worker it is running on at the time.
+template <typename Scheduler>
+task<int> async_fan_out(Scheduler &scheduler, int count, int x) {
+  co_await scheduler.schedule();
+  std::vector<task<int>> children;
+  children.reserve(static_cast<std::size_t>(count));
+  for (int i = 0; i < count; ++i) {
+    children.push_back(async_chain(scheduler, x));
+  }
+  // Wraps instead of overflowing once many results are added up
+  unsigned sum = 0;
+  for (auto &child : children) {
+    sum += static_cast<unsigned>(co_await child);
+  }
+  co_return static_cast<int>(sum);
+}
+
+} // namespace async_coro_numa
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <coroutine>
+#include <cstddef>
+#include <frame_stats.hpp>
 
 namespace async_coro_opt_elidable {
 
@@ -10,6 +12,16 @@ public:
   struct promise_type {
     T value;
 
+    // Frame allocation goes through the size recorder (see frame_stats.hpp)
+    static void *operator new(std::size_t size) {
+      corobench::frame_stats::record(size);
+      return ::operator new(size);
+    }
+
+    static void operator delete(void *ptr, std::size_t size) noexcept {
+      ::operator delete(ptr, size);
+    }
+
     task get_return_object() {
       return task{std::coroutine_handle<promise_type>::from_promise(*this)};
     }
@@ -0,0 +1,256 @@
+#pragma once
+
+#include <coroutine>
+#include <cstddef>
+#include <frame_stats.hpp>
+#include <memory>
+#include <memory_resource>
+#include <new>
+#include <optional>
+#include <stdexcept>
+
+namespace async_coro_pmr {
+
+namespace detail {
+
+inline thread_local constinit std::pmr::memory_resource *default_resource =
+    nullptr;
+
+// The resource pointer is stored right after the frame so operator delete
+// can hand the block back to whichever resource it came from
+constexpr std::size_t resource_offset(std::size_t size) noexcept {
+  return (size + alignof(std::pmr::memory_resource *) - 1) &
+         ~(alignof(std::pmr::memory_resource *) - 1);
+}
+
+constexpr std::size_t total_size(std::size_t size) noexcept {
+  return resource_offset(size) + sizeof(std::pmr::memory_resource *);
+}
+
+} // namespace detail
+
+// Thread-local default resource used by coroutines that are not given one
+// explicitly. Falls back to std::pmr::new_delete_resource().
+inline std::pmr::memory_resource *get_thread_default_resource() noexcept {
+  auto *resource = detail::default_resource;
+  return resource ? resource : std::pmr::new_delete_resource();
+}
+
+// Installs `resource` (nullptr restores the fallback) and returns what was
+// installed before, which is nullptr if nothing was
+inline std::pmr::memory_resource *
+set_thread_default_resource(std::pmr::memory_resource *resource) noexcept {
+  auto *previous = detail::default_resource;
+  detail::default_resource = resource;
+  return previous;
+}
+
+// Installs a thread-local default resource for the lifetime of the scope
+class resource_scope {
+public:
+  explicit resource_scope(std::pmr::memory_resource *resource) noexcept
+      : previous(set_thread_default_resource(resource)) {}
+
+  ~resource_scope() { set_thread_default_resource(previous); }
+
+  resource_scope(const resource_scope &) = delete;
+  resource_scope &operator=(const resource_scope &) = delete;
+
+private:
+  std::pmr::memory_resource *previous;
+};
+
+// Full-safety task (same semantics as async_coro::task) whose frame comes
+// from a std::pmr::memory_resource
+template <typename T> class task {
+public:
+  struct promise_type {
+    std::optional<T> value;
+    std::exception_ptr exception;
+
+    // Selected when the coroutine's parameters start with
+    // (std::allocator_arg_t, std::pmr::memory_resource *)
+    template <typename... Args>
+    static void *operator new(std::size_t size, std::allocator_arg_t,
+                              std::pmr::memory_resource *resource,
+                              const Args &...) {
+      corobench::frame_stats::record(size);
+      return allocate(size, resource);
+    }
+
+    static void *operator new(std::size_t size) {
+      corobench::frame_stats::record(size);
+      return allocate(size, get_thread_default_resource());
+    }
+
+    static void operator delete(void *ptr, std::size_t size) noexcept {
+      auto *frame = static_cast<std::byte *>(ptr);
+      auto *resource =
+          *std::launder(reinterpret_cast<std::pmr::memory_resource **>(
+              frame + detail::resource_offset(size)));
+      resource->deallocate(ptr, detail::total_size(size),
+                           alignof(std::max_align_t));
+    }
+
+    task get_return_object() {
+      return task{std::coroutine_handle<promise_type>::from_promise(*this)};
+    }
+
+    std::suspend_never initial_suspend() { return {}; }
+    std::suspend_always final_suspend() noexcept { return {}; }
+
+    void return_value(T val) { value = std::move(val); }
+
+    void unhandled_exception() { exception = std::current_exception(); }
+
+  private:
+    static void *allocate(std::size_t size,
+                          std::pmr::memory_resource *resource) {
+      auto *frame = static_cast<std::byte *>(resource->allocate(
+          detail::total_size(size), alignof(std::max_align_t)));
+      ::new (frame + detail::resource_offset(size))
+          std::pmr::memory_resource *(resource);
+      return frame;
+    }
+  };
+
+  explicit task(std::coroutine_handle<promise_type> h) : handle(h) {}
+
+  task(task &&other) noexcept : handle(other.handle) { other.handle = nullptr; }
+
+  task &operator=(task &&other) noexcept {
+    if (this != &other) {
+      if (handle) {
+        handle.destroy();
+      }
+      handle = other.handle;
+      other.handle = nullptr;
+    }
+    return *this;
+  }
+
+  ~task() {
+    if (handle) {
+      handle.destroy();
+    }
+  }
+
+  task(const task &) = delete;
+  task &operator=(const task &) = delete;
+
+  T get() {
+    if (!handle) {
+      throw std::runtime_error("Invalid coroutine handle");
+    }
+
+    auto &promise = handle.promise();
+    if (promise.exception) {
+      std::rethrow_exception(promise.exception);
+    }
+
+    if (!promise.value) {
+      throw std::runtime_error("No value available");
+    }
+
+    return *promise.value;
+  }
+
+  bool done() const { return handle && handle.done(); }
+
+  // Awaiter for co_await support
+  struct awaiter {
+    std::coroutine_handle<promise_type> handle;
+
+    bool await_ready() const noexcept { return handle.done(); }
+
+    void await_suspend(std::coroutine_handle<>) noexcept {}
+
+    T await_resume() {
+      if (!handle) {
+        throw std::runtime_error("Invalid coroutine handle");
+      }
+
+      auto &promise = handle.promise();
+      if (promise.exception) {
+        std::rethrow_exception(promise.exception);
+      }
+
+      if (!promise.value) {
+        throw std::runtime_error("No value available");
+      }
+
+      return *promise.value;
+    }
+  };
+
+  awaiter operator co_await() noexcept { return awaiter{handle}; }
+
+private:
+  std::coroutine_handle<promise_type> handle;
+};
+
+// Simple async computation examples
+// Frames come from the thread-local default resource
+task<int> async_compute(int x) {
+  volatile int result = 0;
+  // Perform actual computation that can't be constant-folded
+  for (int i = 0; i < x; i = i + 1) {
+    volatile int temp = i * 31 + (i & 1); // Non-trivial computation
+    result += temp;
+  }
+  co_return static_cast<int>(result);
+}
+
+task<int> async_chain(int x) {
+  int val1 = co_await async_compute(x);
+  int val2 = co_await async_compute(val1 % 100);
+  co_return val1 + val2;
+}
+
+task<int> async_complex_chain(int x) {
+  int v1 = co_await async_compute(x);
+  int v2 = co_await async_compute(v1 % 100);
+  int v3 = co_await async_compute(v2 % 50);
+  co_return v1 + v2 + v3;
+}
+
+// Explicit-resource overloads; the resource is forwarded to nested frames
+
+// GCC sees the frame allocated through memory_resource::allocate and released
+// through promise_type::operator delete, and flags the pair even though the
+// stored resource pointer routes it back to the same resource
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+task<int> async_compute(std::allocator_arg_t, std::pmr::memory_resource *,
+                        int x) {
+  volatile int result = 0;
+  for (int i = 0; i < x; i = i + 1) {
+    volatile int temp = i * 31 + (i & 1);
+    result += temp;
+  }
+  co_return static_cast<int>(result);
+}
+
+task<int> async_chain(std::allocator_arg_t,
+                      std::pmr::memory_resource *resource, int x) {
+  int val1 = co_await async_compute(std::allocator_arg, resource, x);
+  int val2 = co_await async_compute(std::allocator_arg, resource, val1 % 100);
+  co_return val1 + val2;
+}
+
+task<int> async_complex_chain(std::allocator_arg_t,
+                              std::pmr::memory_resource *resource, int x) {
+  int v1 = co_await async_compute(std::allocator_arg, resource, x);
+  int v2 = co_await async_compute(std::allocator_arg, resource, v1 % 100);
+  int v3 = co_await async_compute(std::allocator_arg, resource, v2 % 50);
+  co_return v1 + v2 + v3;
+}
+
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+} // namespace async_coro_pmr
@@ -0,0 +1,188 @@
+#pragma once
+
+#include <coroutine>
+#include <cstddef>
+#include <frame_stats.hpp>
+#include <stop_token>
+#include <utility>
+
+namespace async_coro_stoppable {
+
+// Token of tasks started without one: never stops, and checking it is a null
+// test without touching any shared state
+inline const std::stop_token no_stop_token{};
+
+// Awaitable that yields the current task's stop token without suspending
+struct get_stop_token_t {};
+
+inline constexpr get_stop_token_t get_stop_token{};
+
+// Lazy Task (see coroutine_lazy.hpp) that carries a cooperative stop token.
+// The promise keeps a pointer to the token of the root task, and co_await
+// copies it into the child just before starting it. Passing the token down
+// therefore costs one pointer store per co_await and no reference counting.
+// The root's token must outlive the task.
+//
+// Nothing is cancelled implicitly. Bodies read the token with
+// `co_await get_stop_token` and decide where to check it; stop_requested()
+// is one acquire load once the token has stop state.
+template <typename T> class task {
+public:
+  struct promise_type {
+    T value;
+    std::coroutine_handle<> continuation;
+    const std::stop_token *token = &no_stop_token;
+
+    // Frame allocation goes through the size recorder (see frame_stats.hpp)
+    static void *operator new(std::size_t size) {
+      corobench::frame_stats::record(size);
+      return ::operator new(size);
+    }
+
+    static void operator delete(void *ptr, std::size_t size) noexcept {
+      ::operator delete(ptr, size);
+    }
+
+    task get_return_object() {
+      return task{std::coroutine_handle<promise_type>::from_promise(*this)};
+    }
+
+    // Lazy execution - the body runs only once awaited or started
+    std::suspend_always initial_suspend() noexcept { return {}; }
+
+    // Transfers control to the awaiting coroutine - no stack growth
+    struct final_awaiter {
+      bool await_ready() const noexcept { return false; }
+
+      std::coroutine_handle<>
+      await_suspend(std::coroutine_handle<promise_type> h) noexcept {
+        if (std::coroutine_handle<> next = h.promise().continuation) {
+          return next;
+        }
+        return std::noop_coroutine();
+      }
+
+      void await_resume() const noexcept {}
+    };
+
+    final_awaiter final_suspend() noexcept { return {}; }
+
+    void return_value(T val) noexcept { value = val; }
+
+    // No exception handling for performance
+    void unhandled_exception() noexcept {}
+
+    struct token_awaiter {
+      const std::stop_token &token;
+
+      bool await_ready() const noexcept { return true; }
+
+      void await_suspend(std::coroutine_handle<>) const noexcept {}
+
+      const std::stop_token &await_resume() const noexcept { return token; }
+    };
+
+    token_awaiter await_transform(get_stop_token_t) const noexcept {
+      return {*token};
+    }
+
+    // Every other awaitable passes through unchanged
+    template <typename Awaitable>
+    Awaitable &&await_transform(Awaitable &&awaitable) const noexcept {
+      return std::forward<Awaitable>(awaitable);
+    }
+  };
+
+  explicit task(std::coroutine_handle<promise_type> h) noexcept : handle(h) {}
+
+  task(task &&other) noexcept : handle(other.handle) { other.handle = nullptr; }
+
+  task &operator=(task &&other) noexcept {
+    if (this != &other) {
+      if (handle) {
+        handle.destroy();
+      }
+      handle = other.handle;
+      other.handle = nullptr;
+    }
+    return *this;
+  }
+
+  ~task() {
+    if (handle) {
+      handle.destroy();
+    }
+  }
+
+  task(const task &) = delete;
+  task &operator=(const task &) = delete;
+
+  // Runs a top-level task from its initial suspend point. Control returns
+  // here when it completes or first suspends on something external.
+  void start() noexcept { handle.resume(); }
+
+  // Same, with `token` inherited by every task it awaits
+  void start(const std::stop_token &token) noexcept {
+    handle.promise().token = &token;
+    handle.resume();
+  }
+
+  T get() noexcept { return handle.promise().value; }
+
+  bool done() const noexcept { return handle && handle.done(); }
+
+  // Awaiter for co_await support
+  struct awaiter {
+    std::coroutine_handle<promise_type> handle;
+
+    // The child has not started yet, so always suspend and start it
+    bool await_ready() const noexcept { return false; }
+
+    template <typename Promise>
+    std::coroutine_handle<>
+    await_suspend(std::coroutine_handle<Promise> awaiting) noexcept {
+      promise_type &child = handle.promise();
+      child.continuation = awaiting;
+      // Parents of any task<U> pass their token on; other coroutines don't
+      // have one
+      if constexpr (requires { child.token = awaiting.promise().token; }) {
+        child.token = awaiting.promise().token;
+      }
+      return handle; // Symmetric transfer - no stack growth
+    }
+
+    T await_resume() noexcept { return handle.promise().value; }
+  };
+
+  awaiter operator co_await() noexcept { return awaiter{handle}; }
+
+private:
+  std::coroutine_handle<promise_type> handle;
+};
+
+// Simple async computation that stops early, returning the partial result,
+// once stop is requested
+task<int> async_compute(int x) {
+  const std::stop_token &stop = co_await get_stop_token;
+  volatile int result = 0;
+  for (int i = 0; i < x && !stop.stop_requested(); i = i + 1) {
+    volatile int temp = i * 31 + (i & 1);
+    result += temp;
+  }
+  co_return static_cast<int>(result);
+}
+
+task<int> async_chain(int x) {
+  int val1 = co_await async_compute(x);
+  int val2 = co_await async_compute(val1 % 100);
+  co_return val1 + val2;
+}
+
+task<int> async_complex_chain(int x) {
+  int v1 = co_await async_compute(x);
+  int v2 = co_await async_compute(v1 % 100);
+  int v3 = co_await async_compute(v2 % 50);
+  co_return v1 + v2 + v3;
+}
+
+} // namespace async_coro_stoppable
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <frame_stats.hpp>
+
+namespace corobench {
+
+#ifdef COROBENCH_COUNT_ALLOCATIONS
+// Process-wide totals maintained by the replacement global operator
+// new/delete in src/alloc_hooks.cpp
+struct alloc_totals {
+  std::uint64_t allocs;
+  std::uint64_t frees;
+  std::uint64_t bytes;
+};
+
+alloc_totals alloc_snapshot() noexcept;
+
+// Live and peak bytes need the size of a block when it is freed, which only
+// glibc's malloc_usable_size provides
+#ifdef __GLIBC__
+#define COROBENCH_TRACK_PEAK_BYTES
+
+// Bytes held by live blocks right now, and the most held at once since the
+// last reset_alloc_peak(). Both count usable block sizes, so they include
+// allocator rounding.
+std::uint64_t alloc_live_bytes() noexcept;
+std::uint64_t alloc_peak_bytes() noexcept;
+void reset_alloc_peak() noexcept;
+#endif
+#endif
+
+// Attaches per-iteration counters to a benchmark. Construct it immediately
+// before the timed loop; the destructor reports the deltas once the loop has
+// finished. frames/iter and frame_bytes/iter cover coroutine frames created
+// on the benchmark thread; the heap counters need COROBENCH_COUNT_ALLOCATIONS.
+class scoped_counters {
+public:
+  explicit scoped_counters(benchmark::State &state) noexcept
+      : state(state), frames_start(frame_stats::snapshot())
+#ifdef COROBENCH_COUNT_ALLOCATIONS
+        ,
+        start(alloc_snapshot())
+#endif
+  {
+  }
+
+  ~scoped_counters() {
+    frame_stats::totals frames_end = frame_stats::snapshot();
+    state.counters["frames/iter"] =
+        per_iteration(frames_end.frames - frames_start.frames);
+    state.counters["frame_bytes/iter"] =
+        per_iteration(frames_end.bytes - frames_start.bytes);
+#ifdef COROBENCH_COUNT_ALLOCATIONS
+    alloc_totals end = alloc_snapshot();
+    state.counters["allocs/iter"] =
+        per_iteration(end.allocs - start.allocs);
+    state.counters["bytes/iter"] = per_iteration(end.bytes - start.bytes);
+    state.counters["frees/iter"] = per_iteration(end.frees - start.frees);
+#endif
+  }
+
+  scoped_counters(const scoped_counters &) = delete;
+  scoped_counters &operator=(const scoped_counters &) = delete;
+
+private:
+  static benchmark::Counter per_iteration(std::uint64_t total) {
+    return benchmark::Counter(static_cast<double>(total),
+                              benchmark::Counter::kAvgIterations);
+  }
+
+  benchmark::State &state;
+  frame_stats::totals frames_start;
+#ifdef COROBENCH_COUNT_ALLOCATIONS
+  alloc_totals start;
+#endif
+};
+
+} // namespace corobench
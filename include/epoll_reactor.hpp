@@ -0,0 +1,181 @@
+#pragma once
+
+#include <cerrno>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <sys/epoll.h>
+#include <type_traits>
+#include <unistd.h>
+#include <utility>
+#include <vector>
+
+namespace corobench {
+
+// Readiness reactor on epoll. Every wait is a one-shot registration whose
+// epoll_data points at an intrusive `ready_completion`: the awaitables embed
+// it in the awaiting coroutine's frame, the callback APIs allocate it
+// together with the callback. A descriptor has at most one pending wait at a
+// time; it is added to the epoll set on its first wait and re-armed with
+// EPOLL_CTL_MOD afterwards.
+//
+// Single-threaded: wait and run from the same thread.
+class epoll_reactor {
+public:
+  struct ready_completion {
+    void (*complete)(ready_completion *, std::uint32_t events) noexcept;
+  };
+
+  epoll_reactor() : epoll_fd(epoll_create1(EPOLL_CLOEXEC)) {
+    if (epoll_fd < 0) {
+      error_code = errno;
+    }
+  }
+
+  ~epoll_reactor() {
+    if (epoll_fd >= 0) {
+      close(epoll_fd);
+    }
+  }
+
+  epoll_reactor(const epoll_reactor &) = delete;
+  epoll_reactor &operator=(const epoll_reactor &) = delete;
+
+  bool available() const noexcept { return epoll_fd >= 0; }
+
+  // errno of the failed epoll_create1, 0 when available
+  int error() const noexcept { return error_code; }
+
+  std::size_t pending() const noexcept { return waiting; }
+
+  // Arms a one-shot wait for `events` on fd. Returns false (and arms
+  // nothing) if epoll_ctl fails, e.g. for a closed descriptor.
+  bool arm(int fd, std::uint32_t events, ready_completion *completion) {
+    epoll_event ev{};
+    ev.events = events | EPOLLONESHOT;
+    ev.data.ptr = completion;
+
+    auto index = static_cast<std::size_t>(fd);
+    if (index >= registered.size()) {
+      registered.resize(index + 1, false);
+    }
+    int op = registered[index] ? EPOLL_CTL_MOD : EPOLL_CTL_ADD;
+    if (epoll_ctl(epoll_fd, op, fd, &ev) != 0) {
+      return false;
+    }
+    registered[index] = true;
+    ++waiting;
+    return true;
+  }
+
+  // Removes fd from the epoll set before it is closed or reused
+  void forget(int fd) {
+    auto index = static_cast<std::size_t>(fd);
+    if (index < registered.size() && registered[index]) {
+      epoll_ctl(epoll_fd, EPOLL_CTL_DEL, fd, nullptr);
+      registered[index] = false;
+    }
+  }
+
+  // Waits up to timeout_ms (-1 blocks) and dispatches every ready event
+  std::size_t run_once(int timeout_ms = -1) {
+    epoll_event events[64];
+    int n = epoll_wait(epoll_fd, events, 64, timeout_ms);
+    if (n <= 0) {
+      return 0;
+    }
+    for (int i = 0; i < n; ++i) {
+      auto *completion = static_cast<ready_completion *>(events[i].data.ptr);
+      --waiting;
+      completion->complete(completion, events[i].events);
+    }
+    return static_cast<std::size_t>(n);
+  }
+
+  // Runs until no wait is pending
+  void run() {
+    while (waiting != 0) {
+      run_once();
+    }
+  }
+
+  // Awaitable readiness. The awaiter is the registration's completion
+  // record, so awaiting allocates nothing beyond the coroutine frame.
+  struct ready_awaiter : ready_completion {
+    epoll_reactor &reactor;
+    int fd;
+    std::uint32_t events;
+    std::coroutine_handle<> handle;
+    std::uint32_t result = 0;
+
+    ready_awaiter(epoll_reactor &reactor, int fd,
+                  std::uint32_t events) noexcept
+        : ready_completion{&resume}, reactor(reactor), fd(fd),
+          events(events) {}
+
+    bool await_ready() const noexcept { return false; }
+
+    // Resumes immediately with EPOLLERR when the wait cannot be armed
+    bool await_suspend(std::coroutine_handle<> h) {
+      handle = h;
+      if (!reactor.arm(fd, events, this)) {
+        result = EPOLLERR;
+        return false;
+      }
+      return true;
+    }
+
+    // Ready events (EPOLLIN, EPOLLOUT, EPOLLHUP, ...)
+    std::uint32_t await_resume() const noexcept { return result; }
+
+  private:
+    static void resume(ready_completion *self, std::uint32_t ev) noexcept {
+      auto *awaiter = static_cast<ready_awaiter *>(self);
+      awaiter->result = ev;
+      awaiter->handle.resume();
+    }
+  };
+
+  ready_awaiter readable(int fd) { return {*this, fd, EPOLLIN}; }
+
+  ready_awaiter writable(int fd) { return {*this, fd, EPOLLOUT}; }
+
+  // Callback equivalents: `callback(std::uint32_t events)` runs from
+  // run_once(), or right away with EPOLLERR if the wait cannot be armed
+  template <typename F> void on_readable(int fd, F &&callback) {
+    wait(fd, EPOLLIN, std::forward<F>(callback));
+  }
+
+  template <typename F> void on_writable(int fd, F &&callback) {
+    wait(fd, EPOLLOUT, std::forward<F>(callback));
+  }
+
+private:
+  template <typename F> struct callback_op : ready_completion {
+    explicit callback_op(F &&f)
+        : ready_completion{&invoke}, fn(std::move(f)) {}
+    explicit callback_op(const F &f) : ready_completion{&invoke}, fn(f) {}
+
+    static void invoke(ready_completion *self, std::uint32_t ev) noexcept {
+      auto *op = static_cast<callback_op *>(self);
+      op->fn(ev);
+      delete op;
+    }
+
+    F fn;
+  };
+
+  template <typename F> void wait(int fd, std::uint32_t events, F &&callback) {
+    auto *op = new callback_op<std::decay_t<F>>(std::forward<F>(callback));
+    if (!arm(fd, events, op)) {
+      callback_op<std::decay_t<F>>::invoke(op, EPOLLERR);
+    }
+  }
+
+  int epoll_fd;
+  int error_code = 0;
+  std::vector<bool> registered;
+  std::size_t waiting = 0;
+};
+
+} // namespace corobench
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <cstddef>
+#include <new>
+
+namespace corobench {
+
+// Per-thread freelist allocator for coroutine frames.
+// Requests are rounded up to 16-byte size classes; each class keeps an
+// intrusive singly-linked freelist in thread-local storage, so a frame that
+// is freed on the thread that allocated it is reused without touching malloc.
+// Frames larger than max_pooled_size fall through to global operator new.
+class frame_pool {
+public:
+  static constexpr std::size_t granularity = 16;
+  static constexpr std::size_t max_pooled_size = 1024;
+  static constexpr std::size_t size_classes = max_pooled_size / granularity;
+
+  static void *allocate(std::size_t size) {
+    if (size > max_pooled_size) {
+      return ::operator new(size);
+    }
+
+    std::size_t cls = size_class(size);
+    node *&head = local().heads[cls];
+    if (node *n = head) {
+      head = n->next;
+      return n;
+    }
+    return ::operator new(class_size(cls));
+  }
+
+  static void deallocate(void *ptr, std::size_t size) noexcept {
+    if (size > max_pooled_size) {
+      ::operator delete(ptr, size);
+      return;
+    }
+
+    node *&head = local().heads[size_class(size)];
+    head = ::new (ptr) node{head};
+  }
+
+private:
+  struct node {
+    node *next;
+  };
+
+  struct free_lists {
+    node *heads[size_classes] = {};
+
+    ~free_lists() {
+      for (node *head : heads) {
+        while (head) {
+          node *next = head->next;
+          ::operator delete(head);
+          head = next;
+        }
+      }
+    }
+  };
+
+  // Coroutine frames always hold at least the resume/destroy pointers, so
+  // size is never zero here.
+  static constexpr std::size_t size_class(std::size_t size) noexcept {
+    return (size - 1) / granularity;
+  }
+
+  static constexpr std::size_t class_size(std::size_t cls) noexcept {
+    return (cls + 1) * granularity;
+  }
+
+  static free_lists &local() noexcept {
+    thread_local free_lists lists;
+    return lists;
+  }
+};
+
+} // namespace corobench
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace corobench {
+
+// Records the frame sizes the compiler requests from promise_type::operator
+// new. Every promise in include/ calls record() before allocating, so a frame
+// elided by HALO never shows up here. Counts are thread-local: frames created
+// on other threads are only visible to those threads.
+class frame_stats {
+public:
+  struct totals {
+    std::uint64_t frames;
+    std::uint64_t bytes;
+  };
+
+  static void record(std::size_t size) {
+    ++state.frames;
+    state.bytes += size;
+    if (state.sizes) {
+      state.sizes->push_back(size);
+    }
+  }
+
+  static totals snapshot() noexcept { return {state.frames, state.bytes}; }
+
+  // Appends every size recorded on this thread to `sizes` while alive.
+  // Frames are recorded in creation order, so the first entry after calling
+  // a coroutine is that coroutine's own frame.
+  class trace {
+  public:
+    explicit trace(std::vector<std::size_t> &sizes) noexcept
+        : previous(state.sizes) {
+      state.sizes = &sizes;
+    }
+
+    ~trace() { state.sizes = previous; }
+
+    trace(const trace &) = delete;
+    trace &operator=(const trace &) = delete;
+
+  private:
+    std::vector<std::size_t> *previous;
+  };
+
+private:
+  struct thread_state {
+    std::uint64_t frames;
+    std::uint64_t bytes;
+    std::vector<std::size_t> *sizes;
+  };
+
+  static inline thread_local constinit thread_state state{};
+};
+
+} // namespace corobench
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace corobench {
+
+// Non-owning reference to a callable, two pointers wide.
+// Never allocates; the referenced callable must outlive every call, which
+// holds for the synchronous callback chains in this project.
+template <typename Signature> class function_ref;
+
+template <typename R, typename... Args> class function_ref<R(Args...)> {
+public:
+  template <typename F>
+    requires(!std::is_same_v<std::remove_cvref_t<F>, function_ref> &&
+             std::is_invocable_r_v<R, F &, Args...>)
+  function_ref(F &&f) noexcept
+      : object(const_cast<void *>(
+            static_cast<const void *>(std::addressof(f)))),
+        invoker(&invoke<std::remove_reference_t<F>>) {}
+
+  R operator()(Args... args) const {
+    return invoker(object, std::forward<Args>(args)...);
+  }
+
+private:
+  template <typename F> static R invoke(void *object, Args... args) {
+    return std::invoke(*static_cast<F *>(object), std::forward<Args>(args)...);
+  }
+
+  void *object;
+  R (*invoker)(void *, Args...);
+};
+
+} // namespace corobench
@@ -0,0 +1,94 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace corobench {
+
+// Dedicated threads for moving a coroutine onto another thread.
+// co_await schedule() hands the awaiting coroutine to the next thread in
+// round-robin order, so consecutive hops of one chain alternate threads.
+class hop_threads {
+public:
+  explicit hop_threads(std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+      workers.push_back(std::make_unique<worker>());
+    }
+    for (auto &w : workers) {
+      w->thread = std::thread([&w = *w] { run(w); });
+    }
+  }
+
+  ~hop_threads() {
+    for (auto &w : workers) {
+      {
+        std::lock_guard<std::mutex> lock(w->mutex);
+        w->stop = true;
+      }
+      w->ready.notify_one();
+    }
+    for (auto &w : workers) {
+      w->thread.join();
+    }
+  }
+
+  hop_threads(const hop_threads &) = delete;
+  hop_threads &operator=(const hop_threads &) = delete;
+
+  struct schedule_awaiter {
+    hop_threads &threads;
+
+    bool await_ready() const noexcept { return false; }
+
+    void await_suspend(std::coroutine_handle<> h) { threads.enqueue(h); }
+
+    void await_resume() const noexcept {}
+  };
+
+  schedule_awaiter schedule() noexcept { return {*this}; }
+
+private:
+  struct worker {
+    std::mutex mutex;
+    std::condition_variable ready;
+    std::deque<std::coroutine_handle<>> queue;
+    bool stop = false;
+    std::thread thread;
+  };
+
+  void enqueue(std::coroutine_handle<> h) {
+    worker &w =
+        *workers[next.fetch_add(1, std::memory_order_relaxed) % workers.size()];
+    {
+      std::lock_guard<std::mutex> lock(w.mutex);
+      w.queue.push_back(h);
+    }
+    w.ready.notify_one();
+  }
+
+  static void run(worker &w) {
+    for (;;) {
+      std::unique_lock<std::mutex> lock(w.mutex);
+      w.ready.wait(lock, [&] { return w.stop || !w.queue.empty(); });
+      if (w.queue.empty()) {
+        return;
+      }
+      std::coroutine_handle<> h = w.queue.front();
+      w.queue.pop_front();
+      lock.unlock();
+      h.resume();
+    }
+  }
+
+  std::vector<std::unique_ptr<worker>> workers;
+  std::atomic<std::size_t> next{0};
+};
+
+} // namespace corobench
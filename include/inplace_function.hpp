@@ -0,0 +1,109 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace corobench {
+
+// Owning, copyable callable wrapper with fixed inline storage.
+// Like std::function but never allocates: a callable larger than Capacity is
+// a compile error instead of a heap block.
+template <typename Signature, std::size_t Capacity = 32> class inplace_function;
+
+template <typename R, typename... Args, std::size_t Capacity>
+class inplace_function<R(Args...), Capacity> {
+public:
+  inplace_function() noexcept = default;
+
+  template <typename F>
+    requires(!std::is_same_v<std::remove_cvref_t<F>, inplace_function> &&
+             std::is_invocable_r_v<R, std::decay_t<F> &, Args...>)
+  inplace_function(F &&f) {
+    using Fn = std::decay_t<F>;
+    static_assert(sizeof(Fn) <= Capacity,
+                  "callable does not fit in inplace_function storage");
+    static_assert(alignof(Fn) <= alignof(std::max_align_t),
+                  "callable is over-aligned for inplace_function storage");
+    ::new (storage) Fn(std::forward<F>(f));
+    ops = &ops_for<Fn>;
+  }
+
+  inplace_function(const inplace_function &other) : ops(other.ops) {
+    if (ops) {
+      ops->copy(storage, other.storage);
+    }
+  }
+
+  inplace_function(inplace_function &&other) noexcept : ops(other.ops) {
+    if (ops) {
+      ops->move(storage, other.storage);
+    }
+  }
+
+  inplace_function &operator=(const inplace_function &other) {
+    if (this != &other) {
+      reset();
+      if (other.ops) {
+        other.ops->copy(storage, other.storage);
+        ops = other.ops;
+      }
+    }
+    return *this;
+  }
+
+  inplace_function &operator=(inplace_function &&other) noexcept {
+    if (this != &other) {
+      reset();
+      if (other.ops) {
+        other.ops->move(storage, other.storage);
+        ops = other.ops;
+      }
+    }
+    return *this;
+  }
+
+  ~inplace_function() { reset(); }
+
+  explicit operator bool() const noexcept { return ops != nullptr; }
+
+  R operator()(Args... args) const {
+    return ops->invoke(storage, std::forward<Args>(args)...);
+  }
+
+private:
+  struct vtable {
+    R (*invoke)(void *, Args...);
+    void (*copy)(void *, const void *);
+    void (*move)(void *, void *) noexcept;
+    void (*destroy)(void *) noexcept;
+  };
+
+  template <typename Fn>
+  static constexpr vtable ops_for = {
+      [](void *self, Args... args) -> R {
+        return std::invoke(*static_cast<Fn *>(self),
+                           std::forward<Args>(args)...);
+      },
+      [](void *dst, const void *src) {
+        ::new (dst) Fn(*static_cast<const Fn *>(src));
+      },
+      [](void *dst, void *src) noexcept {
+        ::new (dst) Fn(std::move(*static_cast<Fn *>(src)));
+      },
+      [](void *self) noexcept { static_cast<Fn *>(self)->~Fn(); }};
+
+  void reset() noexcept {
+    if (ops) {
+      ops->destroy(storage);
+      ops = nullptr;
+    }
+  }
+
+  alignas(std::max_align_t) mutable std::byte storage[Capacity];
+  const vtable *ops = nullptr;
+};
+
+} // namespace corobench
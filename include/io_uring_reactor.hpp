@@ -0,0 +1,381 @@
+#pragma once
+
+#include <atomic>
+#include <cerrno>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <type_traits>
+#include <unistd.h>
+#include <utility>
+
+namespace corobench {
+
+// Minimal io_uring reactor on the raw io_uring_setup/io_uring_enter
+// syscalls, so it needs neither liburing nor any other dependency.
+//
+// Every request carries an intrusive `io_completion` as its user_data: the
+// awaitables embed it in the awaiting coroutine's frame, the callback APIs
+// allocate it together with the callback. Preparing a request only fills an
+// SQE; submission is batched into the io_uring_enter made by run_once(),
+// which also dispatches every completion that is ready.
+//
+// If io_uring_enter fails for any reason other than a signal, the reactor
+// becomes unavailable: requests still in the ring are abandoned, and new ones
+// complete at once with the negated errno.
+//
+// Single-threaded: prepare and run from the same thread.
+class io_uring_reactor {
+public:
+  struct io_completion {
+    void (*complete)(io_completion *, int result) noexcept;
+  };
+
+  explicit io_uring_reactor(unsigned entries = 256) {
+    io_uring_params params;
+    std::memset(&params, 0, sizeof(params));
+    int fd = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+    if (fd < 0) {
+      error_code = errno;
+      return;
+    }
+    ring_fd = fd;
+
+    sq_ring_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cq_ring_size =
+        params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+    if (single_mmap) {
+      sq_ring_size = cq_ring_size =
+          sq_ring_size > cq_ring_size ? sq_ring_size : cq_ring_size;
+    }
+
+    sq_ring = map(sq_ring_size, IORING_OFF_SQ_RING);
+    cq_ring = single_mmap ? sq_ring : map(cq_ring_size, IORING_OFF_CQ_RING);
+    sqes = static_cast<io_uring_sqe *>(
+        map(params.sq_entries * sizeof(io_uring_sqe), IORING_OFF_SQES));
+    sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+    if (!sq_ring || !cq_ring || !sqes) {
+      error_code = errno;
+      release();
+      return;
+    }
+
+    auto *sq = static_cast<char *>(sq_ring);
+    sq_head = reinterpret_cast<unsigned *>(sq + params.sq_off.head);
+    sq_tail = reinterpret_cast<unsigned *>(sq + params.sq_off.tail);
+    sq_mask = *reinterpret_cast<unsigned *>(sq + params.sq_off.ring_mask);
+    sq_array = reinterpret_cast<unsigned *>(sq + params.sq_off.array);
+    sq_entries = params.sq_entries;
+
+    auto *cq = static_cast<char *>(cq_ring);
+    cq_head = reinterpret_cast<unsigned *>(cq + params.cq_off.head);
+    cq_tail = reinterpret_cast<unsigned *>(cq + params.cq_off.tail);
+    cq_mask = *reinterpret_cast<unsigned *>(cq + params.cq_off.ring_mask);
+    cqes = reinterpret_cast<io_uring_cqe *>(cq + params.cq_off.cqes);
+
+    local_tail = *sq_tail;
+  }
+
+  ~io_uring_reactor() { release(); }
+
+  io_uring_reactor(const io_uring_reactor &) = delete;
+  io_uring_reactor &operator=(const io_uring_reactor &) = delete;
+
+  // False when the kernel or a seccomp policy refused io_uring_setup, or
+  // once io_uring_enter has failed
+  bool available() const noexcept { return ring_fd >= 0 && error_code == 0; }
+
+  // errno of the failed setup or io_uring_enter, 0 when available
+  int error() const noexcept { return error_code; }
+
+  std::size_t in_flight() const noexcept { return outstanding; }
+
+  // Queues one SQE; flushes queued SQEs first when the ring is full.
+  // Returns false, queuing nothing, once the reactor is unavailable.
+  bool prepare(std::uint8_t opcode, int fd, const void *addr, unsigned len,
+               std::uint64_t offset, io_completion *completion) {
+    if (!available()) {
+      return false;
+    }
+    while (local_tail - load_acquire(sq_head) == sq_entries) {
+      if (!enter(0, 0)) {
+        return false;
+      }
+    }
+    unsigned index = local_tail & sq_mask;
+    io_uring_sqe &sqe = sqes[index];
+    std::memset(&sqe, 0, sizeof(sqe));
+    sqe.opcode = opcode;
+    sqe.fd = fd;
+    sqe.addr = reinterpret_cast<std::uint64_t>(addr);
+    sqe.len = len;
+    sqe.off = offset;
+    sqe.user_data = reinterpret_cast<std::uint64_t>(completion);
+    sq_array[index] = index;
+    ++local_tail;
+    store_release(sq_tail, local_tail);
+    ++unsubmitted;
+    ++outstanding;
+    return true;
+  }
+
+  // Submits queued SQEs, waits for at least one completion if any request
+  // is outstanding, and dispatches every completion available. Dispatches
+  // nothing once the reactor is unavailable.
+  std::size_t run_once() {
+    if (!available() ||
+        !enter(outstanding != 0 ? 1 : 0,
+               outstanding != 0 ? IORING_ENTER_GETEVENTS : 0)) {
+      return 0;
+    }
+    return reap();
+  }
+
+  // Runs until every request, including those queued by completions, is
+  // done, or until the reactor becomes unavailable
+  void run() {
+    while (outstanding != 0 && available()) {
+      run_once();
+    }
+  }
+
+  // Awaitable for one request. The awaiter is the request's io_completion,
+  // so awaiting allocates nothing beyond the coroutine frame.
+  struct io_awaiter : io_completion {
+    io_uring_reactor &reactor;
+    std::uint8_t opcode;
+    int fd;
+    const void *addr;
+    unsigned len;
+    std::uint64_t offset;
+    std::coroutine_handle<> handle;
+    int result = 0;
+
+    io_awaiter(io_uring_reactor &reactor, std::uint8_t opcode, int fd,
+               const void *addr, unsigned len, std::uint64_t offset) noexcept
+        : io_completion{&resume}, reactor(reactor), opcode(opcode), fd(fd),
+          addr(addr), len(len), offset(offset) {}
+
+    bool await_ready() const noexcept { return false; }
+
+    // Resumes at once with the negated errno if the request can't be queued
+    bool await_suspend(std::coroutine_handle<> h) {
+      handle = h;
+      if (!reactor.prepare(opcode, fd, addr, len, offset, this)) {
+        result = -reactor.error();
+        return false;
+      }
+      return true;
+    }
+
+    // Bytes transferred, or a negative errno
+    int await_resume() const noexcept { return result; }
+
+  private:
+    static void resume(io_completion *self, int res) noexcept {
+      auto *awaiter = static_cast<io_awaiter *>(self);
+      awaiter->result = res;
+      awaiter->handle.resume();
+    }
+  };
+
+  // Reads the 8-byte eventfd counter into the awaiter itself
+  struct event_awaiter : io_awaiter {
+    std::uint64_t value = 0;
+
+    event_awaiter(io_uring_reactor &reactor, int fd) noexcept
+        : io_awaiter(reactor, IORING_OP_READ, fd, &value, sizeof(value), 0) {}
+
+    event_awaiter(const event_awaiter &) = delete;
+    event_awaiter &operator=(const event_awaiter &) = delete;
+
+    // Counter value, or a negative errno
+    std::int64_t await_resume() const noexcept {
+      return result < 0 ? result : static_cast<std::int64_t>(value);
+    }
+  };
+
+  io_awaiter read(int fd, void *buf, unsigned len, std::uint64_t offset) {
+    return {*this, IORING_OP_READ, fd, buf, len, offset};
+  }
+
+  io_awaiter write(int fd, const void *buf, unsigned len,
+                   std::uint64_t offset) {
+    return {*this, IORING_OP_WRITE, fd, buf, len, offset};
+  }
+
+  io_awaiter readv(int fd, const iovec *iov, unsigned count,
+                   std::uint64_t offset) {
+    return {*this, IORING_OP_READV, fd, iov, count, offset};
+  }
+
+  event_awaiter wait_event(int fd) { return {*this, fd}; }
+
+  // Callback equivalents: `callback(int result)` runs from run_once() and
+  // receives the same value the awaitables return. If the request can't be
+  // queued, the callback runs at once with the negated errno.
+  template <typename F>
+  void read(int fd, void *buf, unsigned len, std::uint64_t offset,
+            F &&callback) {
+    submit(IORING_OP_READ, fd, buf, len, offset,
+           new callback_op<std::decay_t<F>>(std::forward<F>(callback)));
+  }
+
+  template <typename F>
+  void write(int fd, const void *buf, unsigned len, std::uint64_t offset,
+             F &&callback) {
+    submit(IORING_OP_WRITE, fd, buf, len, offset,
+           new callback_op<std::decay_t<F>>(std::forward<F>(callback)));
+  }
+
+  template <typename F>
+  void readv(int fd, const iovec *iov, unsigned count, std::uint64_t offset,
+             F &&callback) {
+    submit(IORING_OP_READV, fd, iov, count, offset,
+           new callback_op<std::decay_t<F>>(std::forward<F>(callback)));
+  }
+
+  // `callback(std::int64_t counter_or_error)`
+  template <typename F> void wait_event(int fd, F &&callback) {
+    auto *op = new event_op<std::decay_t<F>>(std::forward<F>(callback));
+    submit(IORING_OP_READ, fd, &op->value, sizeof(op->value), 0, op);
+  }
+
+private:
+  void submit(std::uint8_t opcode, int fd, const void *addr, unsigned len,
+              std::uint64_t offset, io_completion *completion) {
+    if (!prepare(opcode, fd, addr, len, offset, completion)) {
+      completion->complete(completion, -error_code);
+    }
+  }
+
+  template <typename F> struct callback_op : io_completion {
+    explicit callback_op(F &&f) : io_completion{&invoke}, fn(std::move(f)) {}
+    explicit callback_op(const F &f) : io_completion{&invoke}, fn(f) {}
+
+    static void invoke(io_completion *self, int res) noexcept {
+      auto *op = static_cast<callback_op *>(self);
+      op->fn(res);
+      delete op;
+    }
+
+    F fn;
+  };
+
+  template <typename F> struct event_op : io_completion {
+    explicit event_op(F &&f) : io_completion{&invoke}, fn(std::move(f)) {}
+    explicit event_op(const F &f) : io_completion{&invoke}, fn(f) {}
+
+    static void invoke(io_completion *self, int res) noexcept {
+      auto *op = static_cast<event_op *>(self);
+      op->fn(res < 0 ? std::int64_t{res} : static_cast<std::int64_t>(op->value));
+      delete op;
+    }
+
+    std::uint64_t value = 0;
+    F fn;
+  };
+
+  static unsigned load_acquire(unsigned *p) noexcept {
+    return std::atomic_ref<unsigned>(*p).load(std::memory_order_acquire);
+  }
+
+  static void store_release(unsigned *p, unsigned v) noexcept {
+    std::atomic_ref<unsigned>(*p).store(v, std::memory_order_release);
+  }
+
+  void *map(std::size_t size, std::uint64_t offset) {
+    void *p = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                   MAP_SHARED | MAP_POPULATE, ring_fd,
+                   static_cast<off_t>(offset));
+    return p == MAP_FAILED ? nullptr : p;
+  }
+
+  // Retries on EINTR. Any other failure is recorded in error_code, which
+  // makes the reactor unavailable, and returns false.
+  bool enter(unsigned min_complete, unsigned flags) {
+    for (;;) {
+      long submitted = syscall(__NR_io_uring_enter, ring_fd, unsubmitted,
+                               min_complete, flags, nullptr, 0);
+      if (submitted >= 0) {
+        unsubmitted -= static_cast<unsigned>(submitted);
+        return true;
+      }
+      if (errno != EINTR) {
+        error_code = errno;
+        return false;
+      }
+    }
+  }
+
+  std::size_t reap() {
+    unsigned head = *cq_head;
+    unsigned tail = load_acquire(cq_tail);
+    std::size_t count = 0;
+    while (head != tail) {
+      io_uring_cqe &cqe = cqes[head & cq_mask];
+      auto *completion = reinterpret_cast<io_completion *>(cqe.user_data);
+      int res = cqe.res;
+      ++head;
+      // Hand the slot back before dispatching, so completions may queue
+      // new requests freely
+      store_release(cq_head, head);
+      --outstanding;
+      ++count;
+      completion->complete(completion, res);
+      tail = load_acquire(cq_tail);
+    }
+    return count;
+  }
+
+  void release() {
+    if (sqes) {
+      munmap(sqes, sqes_size);
+    }
+    if (cq_ring && cq_ring != sq_ring) {
+      munmap(cq_ring, cq_ring_size);
+    }
+    if (sq_ring) {
+      munmap(sq_ring, sq_ring_size);
+    }
+    if (ring_fd >= 0) {
+      close(ring_fd);
+    }
+    sqes = nullptr;
+    cq_ring = sq_ring = nullptr;
+    ring_fd = -1;
+  }
+
+  int ring_fd = -1;
+  int error_code = 0;
+
+  void *sq_ring = nullptr;
+  void *cq_ring = nullptr;
+  io_uring_sqe *sqes = nullptr;
+  std::size_t sq_ring_size = 0;
+  std::size_t cq_ring_size = 0;
+  std::size_t sqes_size = 0;
+
+  unsigned *sq_head = nullptr;
+  unsigned *sq_tail = nullptr;
+  unsigned *sq_array = nullptr;
+  unsigned sq_mask = 0;
+  unsigned sq_entries = 0;
+  unsigned local_tail = 0;
+
+  unsigned *cq_head = nullptr;
+  unsigned *cq_tail = nullptr;
+  unsigned cq_mask = 0;
+  io_uring_cqe *cqes = nullptr;
+
+  unsigned unsubmitted = 0;
+  std::size_t outstanding = 0;
+};
+
+} // namespace corobench
@@ -0,0 +1,218 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <numa_topology.hpp>
+
+#if defined(__linux__)
+#include <linux/mempolicy.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace corobench {
+
+// Frame allocator whose memory is placed per NUMA node. There is one arena
+// per node plus one interleaved arena. Each arena carves 16-byte size-class
+// blocks out of 1 MiB chunks that are mbind()-ed to their node
+// (MPOL_PREFERRED) or spread over every memory node (MPOL_INTERLEAVE).
+//
+// A thread picks its arena on its first pooled allocation: the arena of the
+// node it is running on, or the interleaved arena while set_interleaved(true)
+// is in effect. Pinned workers therefore allocate node-local frames. A freed
+// block goes to the freeing thread's freelists, like in frame_pool, only if
+// the thread's arena owns it; a block freed elsewhere (e.g. after its task was
+// stolen) goes back to the arena recorded in its header. Caches thus only
+// ever hold blocks of their own arena, and memory is never mixed between
+// nodes or policies. When a thread exits, its cached blocks are handed back
+// too, so later threads reuse them.
+//
+// If mbind is unavailable the placement hint is simply dropped.
+class numa_frame_pool {
+public:
+  static constexpr std::size_t granularity = 16;
+  static constexpr std::size_t max_pooled_size = 1024;
+  static constexpr std::size_t size_classes = max_pooled_size / granularity;
+  static constexpr int max_nodes = 64;
+
+  // Placement for threads that make their first pooled allocation afterwards
+  static void set_interleaved(bool on) noexcept {
+    interleave.store(on, std::memory_order_relaxed);
+  }
+
+  static void *allocate(std::size_t size) {
+    if (size > max_pooled_size) {
+      return ::operator new(size);
+    }
+
+    cache &c = local();
+    std::size_t cls = size_class(size);
+    if (!c.heads[cls]) {
+      c.heads[cls] = c.home()->take(cls);
+    }
+    block *b = c.heads[cls];
+    c.heads[cls] = b->next;
+    return b;
+  }
+
+  static void deallocate(void *ptr, std::size_t size) noexcept {
+    if (size > max_pooled_size) {
+      ::operator delete(ptr, size);
+      return;
+    }
+
+    cache &c = local();
+    std::size_t cls = size_class(size);
+    arena *owner = (static_cast<header *>(ptr) - 1)->owner;
+    if (owner != c.owner) {
+      owner->give(::new (ptr) block{nullptr}, cls);
+      return;
+    }
+    c.heads[cls] = ::new (ptr) block{c.heads[cls]};
+  }
+
+private:
+  struct block {
+    block *next;
+  };
+
+  struct arena;
+
+  // Keeps the frame that follows it aligned for operator new
+  struct alignas(std::max_align_t) header {
+    arena *owner;
+  };
+
+  struct arena {
+    static constexpr std::size_t chunk_size = std::size_t{1} << 20;
+
+    std::mutex mutex;
+    block *heads[size_classes] = {};
+    char *cursor = nullptr;
+    char *end = nullptr;
+    int node = -1; // -1: interleaved
+
+    // The arena's whole freelist for cls, or one freshly carved block
+    block *take(std::size_t cls) {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (block *list = heads[cls]) {
+        heads[cls] = nullptr;
+        return list;
+      }
+
+      std::size_t stride = sizeof(header) + class_size(cls);
+      if (static_cast<std::size_t>(end - cursor) < stride) {
+        refill();
+      }
+      auto *hdr = ::new (cursor) header{this};
+      cursor += stride;
+      return ::new (hdr + 1) block{nullptr};
+    }
+
+    void give(block *b, std::size_t cls) {
+      std::lock_guard<std::mutex> lock(mutex);
+      b->next = heads[cls];
+      heads[cls] = b;
+    }
+
+    // The tail of the previous chunk is abandoned
+    void refill() {
+#if defined(__linux__)
+      void *p = mmap(nullptr, chunk_size, PROT_READ | PROT_WRITE,
+                     MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if (p == MAP_FAILED) {
+        throw std::bad_alloc();
+      }
+      unsigned long mask[max_nodes / (8 * sizeof(unsigned long))] = {};
+      int mode = MPOL_PREFERRED;
+      if (node < 0) {
+        mode = MPOL_INTERLEAVE;
+        for (int id : numa_topology::system().memory_nodes()) {
+          set_bit(mask, id);
+        }
+      } else {
+        set_bit(mask, node);
+      }
+      syscall(SYS_mbind, p, chunk_size, mode, mask, max_nodes + 1, 0);
+      cursor = static_cast<char *>(p);
+#else
+      cursor = static_cast<char *>(::operator new(chunk_size));
+#endif
+      end = cursor + chunk_size;
+    }
+
+    static void set_bit(unsigned long *mask, int id) {
+      constexpr int bits = 8 * sizeof(unsigned long);
+      if (id >= 0 && id < max_nodes) {
+        mask[id / bits] |= 1ul << (id % bits);
+      }
+    }
+  };
+
+  struct cache {
+    block *heads[size_classes] = {};
+    arena *owner = nullptr;
+
+    arena *home() {
+      if (!owner) {
+        owner = pick_arena();
+      }
+      return owner;
+    }
+
+    // Hands every cached block back to the arena it was carved from
+    ~cache() {
+      for (std::size_t cls = 0; cls < size_classes; ++cls) {
+        while (block *b = heads[cls]) {
+          heads[cls] = b->next;
+          (reinterpret_cast<header *>(b) - 1)->owner->give(b, cls);
+        }
+      }
+    }
+  };
+
+  static arena *pick_arena() {
+    if (interleave.load(std::memory_order_relaxed)) {
+      return &arenas()[max_nodes];
+    }
+    int node = 0;
+#if defined(__linux__)
+    unsigned cpu = 0;
+    unsigned current = 0;
+    if (syscall(SYS_getcpu, &cpu, &current, nullptr) == 0 &&
+        current < static_cast<unsigned>(max_nodes)) {
+      node = static_cast<int>(current);
+    }
+#endif
+    arena &a = arenas()[node];
+    std::lock_guard<std::mutex> lock(a.mutex);
+    a.node = node;
+    return &a;
+  }
+
+  static constexpr std::size_t size_class(std::size_t size) noexcept {
+    return (size - 1) / granularity;
+  }
+
+  static constexpr std::size_t class_size(std::size_t cls) noexcept {
+    return (cls + 1) * granularity;
+  }
+
+  static cache &local() noexcept {
+    thread_local cache c;
+    return c;
+  }
+
+  // One arena per node, then the interleaved arena
+  static arena *arenas() noexcept {
+    static arena all[max_nodes + 1];
+    return all;
+  }
+
+  static inline std::atomic<bool> interleave{false};
+};
+
+} // namespace corobench
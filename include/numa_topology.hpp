@@ -0,0 +1,112 @@
+#pragma once
+
+#include <affinity.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace corobench {
+
+// NUMA nodes and the CPUs on them, read from /sys/devices/system/node and
+// restricted to the CPUs this process may run on. Without sysfs (or off
+// Linux) every allowed CPU is reported on a single node 0.
+class numa_topology {
+public:
+  struct node {
+    int id;
+    std::vector<int> cpus;
+  };
+
+  // Detected once per process
+  static const numa_topology &system() {
+    static const numa_topology topology = detect();
+    return topology;
+  }
+
+  // Nodes with at least one allowed CPU, in id order
+  const std::vector<node> &nodes() const noexcept { return cpu_nodes; }
+
+  // Ids of every node with memory, for interleaving
+  const std::vector<int> &memory_nodes() const noexcept { return mem_nodes; }
+
+  // Allowed CPUs ordered node by node, so consecutive workers fill one node
+  // before moving to the next
+  std::vector<int> cpus_by_node() const {
+    std::vector<int> cpus;
+    for (const node &n : cpu_nodes) {
+      cpus.insert(cpus.end(), n.cpus.begin(), n.cpus.end());
+    }
+    return cpus;
+  }
+
+  // Node id of an allowed CPU, or -1
+  int node_of(int cpu) const noexcept {
+    for (const node &n : cpu_nodes) {
+      if (std::find(n.cpus.begin(), n.cpus.end(), cpu) != n.cpus.end()) {
+        return n.id;
+      }
+    }
+    return -1;
+  }
+
+private:
+  static numa_topology detect() {
+    numa_topology topology;
+    std::vector<int> allowed = allowed_cpus();
+
+    for (int id : read_list("/sys/devices/system/node/online")) {
+      node n{id, {}};
+      for (int cpu : read_list("/sys/devices/system/node/node" +
+                               std::to_string(id) + "/cpulist")) {
+        if (std::find(allowed.begin(), allowed.end(), cpu) != allowed.end()) {
+          n.cpus.push_back(cpu);
+        }
+      }
+      if (!n.cpus.empty()) {
+        topology.cpu_nodes.push_back(std::move(n));
+      }
+    }
+    topology.mem_nodes = read_list("/sys/devices/system/node/has_memory");
+
+    if (topology.cpu_nodes.empty()) {
+      topology.cpu_nodes.push_back({0, allowed});
+    }
+    if (topology.mem_nodes.empty()) {
+      topology.mem_nodes.push_back(topology.cpu_nodes.front().id);
+    }
+    return topology;
+  }
+
+  // Parses a sysfs list such as "0-3,8,10-11"; empty if the file is missing
+  static std::vector<int> read_list(const std::string &path) {
+    std::vector<int> values;
+    std::ifstream file(path);
+    std::string text;
+    if (!std::getline(file, text)) {
+      return values;
+    }
+    std::stringstream ranges(text);
+    std::string range;
+    while (std::getline(ranges, range, ',')) {
+      if (range.empty()) {
+        continue;
+      }
+      std::size_t dash = range.find('-');
+      int first = std::stoi(range.substr(0, dash));
+      int last =
+          dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+      for (int v = first; v <= last; ++v) {
+        values.push_back(v);
+      }
+    }
+    return values;
+  }
+
+  std::vector<node> cpu_nodes;
+  std::vector<int> mem_nodes;
+};
+
+} // namespace corobench
@@ -0,0 +1,117 @@
+#pragma once
+
+#include <affinity.hpp>
+#include <atomic>
+#include <coroutine>
+#include <spsc_queue.hpp>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace corobench {
+
+// Two threads passing work back and forth through a pair of SPSC queues.
+// The constructing thread is the home side; a second thread is the remote
+// side and runs every Item sent to it. With two or more allowed CPUs the
+// sides are pinned to the first two, so each handoff moves the queue slots
+// and the work's state between cores.
+//
+// Item is anything invocable with no arguments: a std::coroutine_handle<>
+// (operator() resumes it) or a callable.
+template <typename Item> class ping_pong {
+public:
+  ping_pong()
+      : cpus(allowed_cpus()), home_pin(cpus.size() >= 2 ? cpus[0] : -1) {
+    remote = std::thread([this] {
+      pin_scope pin(cpus.size() >= 2 ? cpus[1] : -1);
+      serve();
+    });
+  }
+
+  ~ping_pong() {
+    stop.store(true, std::memory_order_release);
+    remote.join();
+  }
+
+  ping_pong(const ping_pong &) = delete;
+  ping_pong &operator=(const ping_pong &) = delete;
+
+  bool pinned() const noexcept { return home_pin.pinned(); }
+
+  // Home side only
+  void send(Item item) { push(remote_inbox, std::move(item)); }
+
+  // Remote side only
+  void reply(Item item) { push(home_inbox, std::move(item)); }
+
+  // Home side only: waits for one reply and runs it
+  void receive() {
+    for (unsigned spins = 0;; ++spins) {
+      if (auto item = home_inbox.try_pop()) {
+        (*item)();
+        return;
+      }
+      relax(spins);
+    }
+  }
+
+  // Awaitables that continue the awaiting coroutine on the other side
+  struct hop_awaiter {
+    ping_pong &channel;
+    bool outbound;
+
+    bool await_ready() const noexcept { return false; }
+
+    void await_suspend(std::coroutine_handle<> h) {
+      if (outbound) {
+        channel.send(h);
+      } else {
+        channel.reply(h);
+      }
+    }
+
+    void await_resume() const noexcept {}
+  };
+
+  hop_awaiter to_remote() noexcept { return {*this, true}; }
+  hop_awaiter to_home() noexcept { return {*this, false}; }
+
+private:
+  static constexpr std::size_t capacity = 64;
+
+  // Busy-waits for latency, but yields once in a while so the two sides
+  // still make progress when they share a CPU
+  static void relax(unsigned spins) {
+    if (spins % 64 == 63) {
+      std::this_thread::yield();
+    }
+  }
+
+  static void push(spsc_queue<Item, capacity> &queue, Item item) {
+    for (unsigned spins = 0; !queue.try_push(std::move(item)); ++spins) {
+      relax(spins);
+    }
+  }
+
+  void serve() {
+    for (unsigned spins = 0;; ++spins) {
+      if (auto item = remote_inbox.try_pop()) {
+        (*item)();
+        spins = 0;
+      } else if (stop.load(std::memory_order_acquire)) {
+        return;
+      } else {
+        relax(spins);
+      }
+    }
+  }
+
+  std::vector<int> cpus;
+  pin_scope home_pin;
+  spsc_queue<Item, capacity> remote_inbox;
+  spsc_queue<Item, capacity> home_inbox;
+  std::atomic<bool> stop{false};
+  std::thread remote;
+};
+
+} // namespace corobench
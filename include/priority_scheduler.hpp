@@ -0,0 +1,219 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <coroutine>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace corobench {
+
+// Thread pool that runs work in priority order rather than arrival order.
+// Each piece of work is an intrusive `ready_node`: the schedule awaiter is
+// the node, so scheduling a coroutine allocates nothing, and post() puts the
+// node and the callback in one allocation.
+//
+// Workers always take the node with the earliest deadline first
+// (schedule_by/post_by). Next comes the oldest node of the highest non-empty
+// level, where level 0 is the highest. A missed deadline only means the node
+// runs as soon as a worker is free.
+//
+// One mutex guards every queue. Strict ordering needs a single view of all
+// ready work, which per-worker deques cannot give.
+class priority_scheduler {
+public:
+  using clock = std::chrono::steady_clock;
+
+  static constexpr int levels = 4;
+  static constexpr int highest = 0;
+  static constexpr int lowest = levels - 1;
+
+  struct ready_node {
+    void (*run)(ready_node *) noexcept;
+    ready_node *next = nullptr;
+    clock::time_point deadline{};
+  };
+
+  explicit priority_scheduler(std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+      threads.emplace_back([this] { run(); });
+    }
+  }
+
+  // Runs everything still queued, then joins the workers
+  ~priority_scheduler() {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      stop = true;
+    }
+    ready.notify_all();
+    for (auto &thread : threads) {
+      thread.join();
+    }
+  }
+
+  priority_scheduler(const priority_scheduler &) = delete;
+  priority_scheduler &operator=(const priority_scheduler &) = delete;
+
+  std::size_t size() const noexcept { return threads.size(); }
+
+  // Queues `node` behind the other nodes of `level`, clamped to
+  // [highest, lowest]
+  void submit(ready_node *node, int level) {
+    level = std::clamp(level, highest, lowest);
+    node->next = nullptr;
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      fifo &queue = queues[level];
+      if (queue.tail) {
+        queue.tail->next = node;
+      } else {
+        queue.head = node;
+      }
+      queue.tail = node;
+      ++pending;
+    }
+    ready.notify_one();
+  }
+
+  // Queues `node` ahead of all levels, ordered by deadline
+  void submit_by(ready_node *node, clock::time_point deadline) {
+    node->deadline = deadline;
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      by_deadline.push_back(node);
+      std::push_heap(by_deadline.begin(), by_deadline.end(), later);
+      ++pending;
+    }
+    ready.notify_one();
+  }
+
+  // co_await schedule(level) / schedule_by(deadline) continues on a worker
+  class schedule_awaiter : ready_node {
+  public:
+    schedule_awaiter(priority_scheduler &scheduler, int level) noexcept
+        : ready_node{&resume}, scheduler(scheduler), level(level) {}
+
+    schedule_awaiter(priority_scheduler &scheduler,
+                     clock::time_point deadline) noexcept
+        : ready_node{&resume, nullptr, deadline}, scheduler(scheduler),
+          level(-1) {}
+
+    bool await_ready() const noexcept { return false; }
+
+    void await_suspend(std::coroutine_handle<> h) {
+      handle = h;
+      if (level < 0) {
+        scheduler.submit_by(this, deadline);
+      } else {
+        scheduler.submit(this, level);
+      }
+    }
+
+    void await_resume() const noexcept {}
+
+  private:
+    static void resume(ready_node *self) noexcept {
+      static_cast<schedule_awaiter *>(self)->handle.resume();
+    }
+
+    priority_scheduler &scheduler;
+    int level; // -1: ordered by deadline
+    std::coroutine_handle<> handle;
+  };
+
+  schedule_awaiter schedule(int level) noexcept { return {*this, level}; }
+
+  schedule_awaiter schedule_by(clock::time_point deadline) noexcept {
+    return {*this, deadline};
+  }
+
+  // Lowest level, so generic code written against schedule() is background
+  // work here
+  schedule_awaiter schedule() noexcept { return {*this, lowest}; }
+
+  // Callback equivalents
+  template <typename F> void post(int level, F &&f) {
+    submit(new node<std::decay_t<F>>(std::forward<F>(f)), level);
+  }
+
+  template <typename F> void post_by(clock::time_point deadline, F &&f) {
+    submit_by(new node<std::decay_t<F>>(std::forward<F>(f)), deadline);
+  }
+
+  template <typename F> void post(F &&f) { post(lowest, std::forward<F>(f)); }
+
+private:
+  struct fifo {
+    ready_node *head = nullptr;
+    ready_node *tail = nullptr;
+  };
+
+  template <typename F> struct node : ready_node {
+    explicit node(F &&f) : ready_node{&invoke}, fn(std::move(f)) {}
+    explicit node(const F &f) : ready_node{&invoke}, fn(f) {}
+
+    static void invoke(ready_node *self) noexcept {
+      auto *n = static_cast<node *>(self);
+      n->fn();
+      delete n;
+    }
+
+    F fn;
+  };
+
+  // Heap order for by_deadline: the earliest deadline on top
+  static bool later(const ready_node *a, const ready_node *b) noexcept {
+    return a->deadline > b->deadline;
+  }
+
+  // Called with the mutex held and pending != 0
+  ready_node *take() noexcept {
+    --pending;
+    if (!by_deadline.empty()) {
+      std::pop_heap(by_deadline.begin(), by_deadline.end(), later);
+      ready_node *node = by_deadline.back();
+      by_deadline.pop_back();
+      return node;
+    }
+    for (fifo &queue : queues) {
+      if (ready_node *node = queue.head) {
+        queue.head = node->next;
+        if (!queue.head) {
+          queue.tail = nullptr;
+        }
+        return node;
+      }
+    }
+    return nullptr;
+  }
+
+  void run() {
+    std::unique_lock<std::mutex> lock(mutex);
+    for (;;) {
+      ready.wait(lock, [&] { return stop || pending != 0; });
+      if (pending == 0) {
+        return;
+      }
+      ready_node *node = take();
+      lock.unlock();
+      node->run(node);
+      lock.lock();
+    }
+  }
+
+  std::mutex mutex;
+  std::condition_variable ready;
+  fifo queues[levels];
+  std::vector<ready_node *> by_deadline;
+  std::size_t pending = 0;
+  bool stop = false;
+  std::vector<std::thread> threads;
+};
+
+} // namespace corobench
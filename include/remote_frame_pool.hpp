@@ -0,0 +1,126 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <new>
+
+namespace corobench {
+
+// Frame allocator that returns cross-thread frees to the owning thread.
+// Each thread owns a heap with, per 16-byte size class, a plain local freelist
+// and a lock-free remote freelist. A block carries its owner heap in a small
+// header: freeing on the owner thread pushes onto the local list, freeing on
+// any other thread pushes onto the owner's remote list with a single CAS. The
+// owner takes the whole remote list with one exchange when its local list
+// runs dry, so blocks always flow back to the thread that allocates them.
+//
+// Heaps are never destroyed. When a thread exits its heap is abandoned and
+// adopted by the next thread that needs one, so late remote frees are never
+// lost and memory stays bounded by the peak number of live threads.
+class remote_frame_pool {
+public:
+  static constexpr std::size_t granularity = 16;
+  static constexpr std::size_t max_pooled_size = 1024;
+  static constexpr std::size_t size_classes = max_pooled_size / granularity;
+
+  static void *allocate(std::size_t size) {
+    if (size > max_pooled_size) {
+      return ::operator new(size);
+    }
+
+    heap *h = local_heap();
+    std::size_t cls = size_class(size);
+    block *b = h->local[cls];
+    if (!b && h->remote[cls].load(std::memory_order_relaxed)) {
+      b = h->remote[cls].exchange(nullptr, std::memory_order_acquire);
+    }
+    if (b) {
+      h->local[cls] = b->next;
+      return b;
+    }
+
+    auto *hdr = static_cast<header *>(
+        ::operator new(sizeof(header) + class_size(cls)));
+    hdr->owner = h;
+    return hdr + 1;
+  }
+
+  static void deallocate(void *ptr, std::size_t size) noexcept {
+    if (size > max_pooled_size) {
+      ::operator delete(ptr, size);
+      return;
+    }
+
+    heap *owner = (static_cast<header *>(ptr) - 1)->owner;
+    std::size_t cls = size_class(size);
+    if (owner == current) {
+      owner->local[cls] = ::new (ptr) block{owner->local[cls]};
+      return;
+    }
+
+    std::atomic<block *> &remote = owner->remote[cls];
+    block *b = ::new (ptr) block{remote.load(std::memory_order_relaxed)};
+    while (!remote.compare_exchange_weak(b->next, b, std::memory_order_release,
+                                         std::memory_order_relaxed)) {
+    }
+  }
+
+private:
+  struct block {
+    block *next;
+  };
+
+  struct heap {
+    block *local[size_classes] = {};
+    std::atomic<block *> remote[size_classes] = {};
+    heap *next_abandoned = nullptr;
+  };
+
+  // Keeps the frame that follows it aligned for operator new
+  struct alignas(std::max_align_t) header {
+    heap *owner;
+  };
+
+  // Abandons the thread's heap on thread exit
+  struct heap_owner {
+    ~heap_owner() {
+      if (current) {
+        std::lock_guard<std::mutex> lock(registry_mutex);
+        current->next_abandoned = abandoned;
+        abandoned = current;
+        current = nullptr;
+      }
+    }
+  };
+
+  static constexpr std::size_t size_class(std::size_t size) noexcept {
+    return (size - 1) / granularity;
+  }
+
+  static constexpr std::size_t class_size(std::size_t cls) noexcept {
+    return (cls + 1) * granularity;
+  }
+
+  static heap *local_heap() {
+    return current ? current : attach();
+  }
+
+  static heap *attach() {
+    thread_local heap_owner owner;
+    std::lock_guard<std::mutex> lock(registry_mutex);
+    if (abandoned) {
+      current = abandoned;
+      abandoned = abandoned->next_abandoned;
+    } else {
+      current = new heap;
+    }
+    return current;
+  }
+
+  static inline thread_local constinit heap *current = nullptr;
+  static inline std::mutex registry_mutex;
+  static inline heap *abandoned = nullptr;
+};
+
+} // namespace corobench
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <algorithm>
+#include <coroutine>
+#include <cstddef>
+#include <vector>
+
+namespace corobench {
+
+// Run queue of ready coroutines kept as one contiguous array of handles.
+// Resuming a coroutine whose frame has gone cold stalls on its first access
+// to the frame, and a plain drain pays that miss once per handle, one after
+// another. drain_prefetched(batch) walks the queue in groups of `batch` and
+// prefetches every frame of the next group before resuming the current one,
+// so those misses overlap with useful work. Reading the handle array itself
+// is sequential and left to the hardware prefetcher.
+//
+// Handles are type-erased, so the promise is not located exactly. Frames
+// start with the resume/destroy pointers and every ABI places the promise
+// right behind them, so the first two cache lines of a frame cover both.
+//
+// Single-threaded: push and drain from the same thread.
+class resume_queue {
+public:
+  struct schedule_awaiter {
+    resume_queue &queue;
+
+    bool await_ready() const noexcept { return false; }
+
+    void await_suspend(std::coroutine_handle<> h) { queue.push(h); }
+
+    void await_resume() const noexcept {}
+  };
+
+  schedule_awaiter schedule() noexcept { return {*this}; }
+
+  void push(std::coroutine_handle<> h) { ready.push_back(h); }
+
+  std::size_t size() const noexcept { return ready.size(); }
+
+  bool empty() const noexcept { return ready.empty(); }
+
+  // Resumes every queued coroutine in order, including any queued while
+  // draining. Returns how many were resumed.
+  std::size_t drain() {
+    std::size_t resumed = 0;
+    while (!ready.empty()) {
+      running.swap(ready);
+      for (std::coroutine_handle<> h : running) {
+        h.resume();
+      }
+      resumed += running.size();
+      running.clear();
+    }
+    return resumed;
+  }
+
+  // Same as drain(), prefetching the frames of the next `batch` handles
+  // before resuming the current ones. A batch of 0 is a plain drain.
+  std::size_t drain_prefetched(std::size_t batch) {
+    if (batch == 0) {
+      return drain();
+    }
+    std::size_t resumed = 0;
+    while (!ready.empty()) {
+      running.swap(ready);
+      std::size_t n = running.size();
+      prefetch(0, std::min(batch, n));
+      for (std::size_t first = 0; first < n; first += batch) {
+        std::size_t last = std::min(first + batch, n);
+        prefetch(last, std::min(last + batch, n));
+        for (std::size_t i = first; i < last; ++i) {
+          running[i].resume();
+        }
+      }
+      resumed += n;
+      running.clear();
+    }
+    return resumed;
+  }
+
+private:
+  void prefetch(std::size_t first, std::size_t last) const noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    for (std::size_t i = first; i < last; ++i) {
+      const char *frame = static_cast<const char *>(running[i].address());
+      // Resuming writes the frame, so ask for the lines in exclusive state
+      __builtin_prefetch(frame, 1, 3);
+      __builtin_prefetch(frame + 64, 1, 3);
+    }
+#else
+    (void)first;
+    (void)last;
+#endif
+  }
+
+  std::vector<std::coroutine_handle<>> ready;
+  // The batch being resumed; swapped with `ready` so both keep their capacity
+  std::vector<std::coroutine_handle<>> running;
+};
+
+} // namespace corobench
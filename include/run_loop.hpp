@@ -0,0 +1,81 @@
+#pragma once
+
+#include <coroutine>
+#include <deque>
+#include <functional>
+#include <utility>
+
+namespace corobench {
+
+// Single-threaded io_context-style run loop.
+// Coroutines queue themselves with co_await schedule(); the awaiter is the
+// intrusive queue node and lives in the suspended frame, so scheduling a
+// coroutine never allocates. Callbacks are queued with post().
+class run_loop {
+public:
+  class schedule_awaiter {
+  public:
+    explicit schedule_awaiter(run_loop &loop) noexcept : loop(loop) {}
+
+    bool await_ready() const noexcept { return false; }
+
+    void await_suspend(std::coroutine_handle<> h) noexcept {
+      handle = h;
+      loop.push(this);
+    }
+
+    void await_resume() const noexcept {}
+
+  private:
+    friend class run_loop;
+
+    run_loop &loop;
+    std::coroutine_handle<> handle;
+    schedule_awaiter *next = nullptr;
+  };
+
+  run_loop() = default;
+  run_loop(const run_loop &) = delete;
+  run_loop &operator=(const run_loop &) = delete;
+
+  schedule_awaiter schedule() noexcept { return schedule_awaiter{*this}; }
+
+  void post(std::function<void()> fn) { posted.push_back(std::move(fn)); }
+
+  // Resumes queued coroutines and runs posted callbacks, including any they
+  // queue in turn, until both queues are empty
+  void run() {
+    for (;;) {
+      if (head) {
+        schedule_awaiter *op = head;
+        head = op->next;
+        if (!head) {
+          tail = nullptr;
+        }
+        op->handle.resume();
+      } else if (!posted.empty()) {
+        std::function<void()> fn = std::move(posted.front());
+        posted.pop_front();
+        fn();
+      } else {
+        return;
+      }
+    }
+  }
+
+private:
+  void push(schedule_awaiter *op) noexcept {
+    if (tail) {
+      tail->next = op;
+    } else {
+      head = op;
+    }
+    tail = op;
+  }
+
+  schedule_awaiter *head = nullptr;
+  schedule_awaiter *tail = nullptr;
+  std::deque<std::function<void()>> posted;
+};
+
+} // namespace corobench
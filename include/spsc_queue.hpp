@@ -0,0 +1,73 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <optional>
+#include <utility>
+
+namespace corobench {
+
+// Bounded lock-free single-producer/single-consumer ring buffer.
+// Head and tail live on separate cache lines, and each side caches the other
+// side's index so the common case touches only its own line.
+template <typename T, std::size_t Capacity> class spsc_queue {
+  static_assert(Capacity != 0 && (Capacity & (Capacity - 1)) == 0,
+                "Capacity must be a power of two");
+
+public:
+  spsc_queue() = default;
+
+  ~spsc_queue() {
+    while (try_pop()) {
+    }
+  }
+
+  spsc_queue(const spsc_queue &) = delete;
+  spsc_queue &operator=(const spsc_queue &) = delete;
+
+  // Producer side. Leaves `value` untouched when the queue is full.
+  bool try_push(T &&value) {
+    std::size_t t = tail.load(std::memory_order_relaxed);
+    if (t - head_cache == Capacity) {
+      head_cache = head.load(std::memory_order_acquire);
+      if (t - head_cache == Capacity) {
+        return false;
+      }
+    }
+    ::new (&slots[t & (Capacity - 1)].value) T(std::move(value));
+    tail.store(t + 1, std::memory_order_release);
+    return true;
+  }
+
+  // Consumer side
+  std::optional<T> try_pop() {
+    std::size_t h = head.load(std::memory_order_relaxed);
+    if (h == tail_cache) {
+      tail_cache = tail.load(std::memory_order_acquire);
+      if (h == tail_cache) {
+        return std::nullopt;
+      }
+    }
+    T &slot = slots[h & (Capacity - 1)].value;
+    std::optional<T> value(std::move(slot));
+    slot.~T();
+    head.store(h + 1, std::memory_order_release);
+    return value;
+  }
+
+private:
+  union slot {
+    slot() noexcept {}
+    ~slot() {}
+    T value;
+  };
+
+  alignas(64) std::atomic<std::size_t> head{0};
+  std::size_t tail_cache = 0;
+  alignas(64) std::atomic<std::size_t> tail{0};
+  std::size_t head_cache = 0;
+  alignas(64) slot slots[Capacity];
+};
+
+} // namespace corobench
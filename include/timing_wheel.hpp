@@ -0,0 +1,238 @@
+#pragma once
+
+#include <chrono>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace corobench {
+
+// Intrusive timer record. The wheel links it into one slot list; `pprev`
+// points at whatever points at the node, so unlinking is O(1) without a
+// sentinel. complete(node, true) runs on expiry, complete(node, false) when
+// cancel() removes it.
+struct timer_node {
+  void (*complete)(timer_node *, bool expired) noexcept;
+  timer_node *next = nullptr;
+  timer_node **pprev = nullptr;
+  std::uint64_t deadline = 0;
+
+  bool pending() const noexcept { return pprev != nullptr; }
+};
+
+// Hierarchical timing wheel: four levels of 256 slots, each level covering
+// 256 times the span of the one below, for about 2^32 ticks in total. A timer
+// is filed on the lowest level whose span still separates its deadline from
+// the current tick. Whenever a level wraps, the next slot of the level above is
+// cascaded down, so each timer moves at most three times before it expires.
+// Insert and cancel are O(1); advancing costs O(1) per tick plus the timers
+// that cascade or expire.
+//
+// Time only moves when advance() is called, so the wheel can be driven by a
+// clock or, as in the benchmarks, stepped directly. Single-threaded.
+class timing_wheel {
+public:
+  static constexpr unsigned levels = 4;
+  static constexpr unsigned slot_bits = 8;
+  static constexpr std::size_t slots = std::size_t{1} << slot_bits;
+  // One top-level slot short of the full range, so a deadline never lands
+  // in the top-level slot that is currently being passed
+  static constexpr std::uint64_t max_delay =
+      (std::uint64_t{1} << (levels * slot_bits)) -
+      (std::uint64_t{1} << ((levels - 1) * slot_bits));
+
+  explicit timing_wheel(
+      std::chrono::nanoseconds tick = std::chrono::milliseconds(1))
+      : tick(tick) {}
+
+  timing_wheel(const timing_wheel &) = delete;
+  timing_wheel &operator=(const timing_wheel &) = delete;
+
+  std::uint64_t now() const noexcept { return current; }
+
+  std::size_t size() const noexcept { return count; }
+
+  // Rounds a duration up to whole ticks, at least one
+  std::uint64_t ticks_for(std::chrono::nanoseconds d) const noexcept {
+    auto ticks = (d.count() + tick.count() - 1) / tick.count();
+    return ticks < 1 ? 1 : static_cast<std::uint64_t>(ticks);
+  }
+
+  // Files `node` to expire `delay` ticks from now (at least one, at most
+  // max_delay)
+  void schedule(timer_node *node, std::uint64_t delay) noexcept {
+    delay = delay < 1 ? 1 : (delay > max_delay ? max_delay : delay);
+    node->deadline = current + delay;
+    file(node);
+    ++count;
+  }
+
+  // Removes a pending timer and completes it with expired == false
+  bool cancel(timer_node *node) noexcept {
+    if (!node->pending()) {
+      return false;
+    }
+    unlink(node);
+    node->complete(node, false);
+    return true;
+  }
+
+  // Moves time forward tick by tick, expiring due timers. Returns how many
+  // expired.
+  std::size_t advance(std::uint64_t ticks) {
+    std::size_t expired = 0;
+    for (std::uint64_t i = 0; i < ticks; ++i) {
+      expired += step();
+    }
+    return expired;
+  }
+
+  // Awaitable sleep. The awaiter is the timer node, so a sleeping coroutine
+  // costs its frame and nothing else; destroying the suspended coroutine
+  // unlinks the timer.
+  struct sleep_awaiter : timer_node {
+    timing_wheel &wheel;
+    std::uint64_t delay;
+    std::coroutine_handle<> handle;
+    bool expired = false;
+
+    sleep_awaiter(timing_wheel &wheel, std::uint64_t delay) noexcept
+        : timer_node{&resume}, wheel(wheel), delay(delay) {}
+
+    sleep_awaiter(const sleep_awaiter &) = delete;
+    sleep_awaiter &operator=(const sleep_awaiter &) = delete;
+
+    ~sleep_awaiter() {
+      if (pending()) {
+        wheel.unlink(this);
+      }
+    }
+
+    bool await_ready() const noexcept { return false; }
+
+    void await_suspend(std::coroutine_handle<> h) noexcept {
+      handle = h;
+      wheel.schedule(this, delay);
+    }
+
+    // True when the timer expired, false when it was cancelled
+    bool await_resume() const noexcept { return expired; }
+
+  private:
+    static void resume(timer_node *self, bool expired) noexcept {
+      auto *awaiter = static_cast<sleep_awaiter *>(self);
+      awaiter->expired = expired;
+      awaiter->handle.resume();
+    }
+  };
+
+  sleep_awaiter sleep_for(std::chrono::nanoseconds d) {
+    return {*this, ticks_for(d)};
+  }
+
+  // Callback equivalent: callback() runs on expiry. The node holding it is
+  // freed after it runs or when the returned timer is cancelled.
+  template <typename F>
+  timer_node *schedule_after(std::chrono::nanoseconds d, F &&callback) {
+    auto *node =
+        new callback_timer<std::decay_t<F>>(std::forward<F>(callback));
+    schedule(node, ticks_for(d));
+    return node;
+  }
+
+  // Size of the node schedule_after() allocates for a callable of type F
+  template <typename F> static constexpr std::size_t callback_size() noexcept {
+    return sizeof(callback_timer<std::decay_t<F>>);
+  }
+
+private:
+  template <typename F> struct callback_timer : timer_node {
+    explicit callback_timer(F &&f) : timer_node{&invoke}, fn(std::move(f)) {}
+    explicit callback_timer(const F &f) : timer_node{&invoke}, fn(f) {}
+
+    static void invoke(timer_node *self, bool expired) noexcept {
+      auto *timer = static_cast<callback_timer *>(self);
+      if (expired) {
+        timer->fn();
+      }
+      delete timer;
+    }
+
+    F fn;
+  };
+
+  static std::size_t slot_index(std::uint64_t t, unsigned level) noexcept {
+    return static_cast<std::size_t>(t >> (level * slot_bits)) & (slots - 1);
+  }
+
+  void file(timer_node *node) noexcept {
+    unsigned level = 0;
+    while (level + 1 < levels &&
+           (node->deadline >> ((level + 1) * slot_bits)) !=
+               (current >> ((level + 1) * slot_bits))) {
+      ++level;
+    }
+    timer_node *&head = wheel[level][slot_index(node->deadline, level)];
+    node->next = head;
+    node->pprev = &head;
+    if (head) {
+      head->pprev = &node->next;
+    }
+    head = node;
+  }
+
+  void unlink(timer_node *node) noexcept {
+    *node->pprev = node->next;
+    if (node->next) {
+      node->next->pprev = node->pprev;
+    }
+    node->next = nullptr;
+    node->pprev = nullptr;
+    --count;
+  }
+
+  std::size_t step() {
+    ++current;
+
+    // Cascade every level that just wrapped, highest first, so timers
+    // trickle down to the slots they now belong to
+    unsigned wrapped = 1;
+    while (wrapped < levels && slot_index(current, wrapped - 1) == 0) {
+      ++wrapped;
+    }
+    for (unsigned level = wrapped - 1; level >= 1; --level) {
+      timer_node *node = wheel[level][slot_index(current, level)];
+      wheel[level][slot_index(current, level)] = nullptr;
+      while (node) {
+        timer_node *next = node->next;
+        file(node);
+        node = next;
+      }
+    }
+
+    // Detach the due slot first: callbacks may schedule or cancel timers
+    timer_node *&slot = wheel[0][slot_index(current, 0)];
+    timer_node *due = slot;
+    slot = nullptr;
+    if (due) {
+      due->pprev = &due;
+    }
+    std::size_t expired = 0;
+    while (due) {
+      timer_node *node = due;
+      unlink(node);
+      node->complete(node, true);
+      ++expired;
+    }
+    return expired;
+  }
+
+  std::chrono::nanoseconds tick;
+  std::uint64_t current = 0;
+  std::size_t count = 0;
+  timer_node *wheel[levels][slots] = {};
+};
+
+} // namespace corobench
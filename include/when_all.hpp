@@ -0,0 +1,134 @@
+#pragma once
+
+#include <atomic>
+#include <coroutine>
+#include <coroutine_atomic.hpp>
+#include <cstddef>
+#include <ranges>
+#include <tuple>
+#include <utility>
+
+namespace async_coro_atomic {
+
+// co_await when_all(...) resumes the parent once every child task has
+// finished. One join_counter, stored in the awaiter and so in the parent's
+// frame, is installed as the continuation of every child. Nothing is
+// allocated per child, and no wrapper coroutine is started either.
+//
+// The counter starts at children + 1. The extra count belongs to the awaiter
+// itself, so no child can resume the parent while children are still being
+// attached. Children that have already finished are counted down by the
+// awaiter, and if that brings the count to zero the parent does not suspend.
+//
+// Counter may extend join_counter with state for its `arrive` hook.
+template <typename Counter = join_counter> class join_awaiter {
+protected:
+  join_awaiter() = default;
+  join_awaiter(const join_awaiter &) = delete;
+  join_awaiter &operator=(const join_awaiter &) = delete;
+
+  void open(std::coroutine_handle<> parent, std::size_t children) noexcept {
+    join.continuation = parent;
+    join.remaining.store(children + 1, std::memory_order_relaxed);
+  }
+
+  // Makes the join the child's continuation. Returns false if the child has
+  // already finished and so will not count down.
+  template <typename Promise> bool attach(Promise &promise) noexcept {
+    if (promise.finished()) {
+      return false;
+    }
+    void *previous =
+        promise.state.exchange(join.tagged(), std::memory_order_acq_rel);
+    if (previous == &promise) {
+      // Finished in the meantime: restore the marker that get() waits for
+      promise.state.store(&promise, std::memory_order_release);
+      return false;
+    }
+    return true;
+  }
+
+  // Counts down the awaiter's share plus the children that had already
+  // finished. Returns true if the parent stays suspended.
+  bool close(std::size_t finished) noexcept {
+    std::size_t share = finished + 1;
+    return join.remaining.fetch_sub(share, std::memory_order_acq_rel) != share;
+  }
+
+  Counter join{};
+};
+
+// Owns the children and yields a tuple of their results
+template <typename... Tasks> class when_all_awaiter : join_awaiter<> {
+public:
+  explicit when_all_awaiter(Tasks &&...children) noexcept
+      : tasks(std::move(children)...) {}
+
+  bool await_ready() const noexcept {
+    return std::apply([](const auto &...t) { return (t.done() && ...); },
+                      tasks);
+  }
+
+  bool await_suspend(std::coroutine_handle<> parent) noexcept {
+    open(parent, sizeof...(Tasks));
+    std::size_t finished = std::apply(
+        [this](auto &...t) {
+          return (std::size_t{0} + ... +
+                  static_cast<std::size_t>(!attach(t.promise())));
+        },
+        tasks);
+    return close(finished);
+  }
+
+  auto await_resume() noexcept {
+    return std::apply(
+        [](auto &...t) { return std::make_tuple(t.promise().value...); },
+        tasks);
+  }
+
+private:
+  std::tuple<Tasks...> tasks;
+};
+
+// Joins a range of tasks owned by the caller. Afterwards every task is
+// finished, so get() returns its result without waiting.
+template <typename Range> class when_all_range_awaiter : join_awaiter<> {
+public:
+  explicit when_all_range_awaiter(Range &tasks) noexcept : tasks(tasks) {}
+
+  bool await_ready() const noexcept {
+    for (const auto &t : tasks) {
+      if (!t.done()) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  bool await_suspend(std::coroutine_handle<> parent) noexcept {
+    open(parent, static_cast<std::size_t>(std::ranges::distance(tasks)));
+    std::size_t finished = 0;
+    for (auto &t : tasks) {
+      finished += static_cast<std::size_t>(!attach(t.promise()));
+    }
+    return close(finished);
+  }
+
+  void await_resume() const noexcept {}
+
+private:
+  Range &tasks;
+};
+
+// Takes ownership of the tasks: pass temporaries or std::move them
+template <typename... Tasks>
+when_all_awaiter<Tasks...> when_all(Tasks... tasks) {
+  return when_all_awaiter<Tasks...>(std::move(tasks)...);
+}
+
+template <std::ranges::forward_range Range>
+when_all_range_awaiter<Range> when_all(Range &tasks) {
+  return when_all_range_awaiter<Range>(tasks);
+}
+
+} // namespace async_coro_atomic
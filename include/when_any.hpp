@@ -0,0 +1,82 @@
+#pragma once
+
+#include <coroutine>
+#include <coroutine_atomic.hpp>
+#include <cstddef>
+#include <ranges>
+#include <stop_token>
+#include <when_all.hpp>
+
+namespace async_coro_atomic {
+
+// Join counter of when_any: the stop source to trigger and the promise of
+// the child that triggered it
+struct race_counter : join_counter {
+  std::stop_source *stop = nullptr;
+  void *winner = nullptr;
+};
+
+// co_await when_any(stop, tasks) races a range of tasks owned by the caller
+// and returns the index of the first one to finish. That child's arrival
+// calls stop.request_stop(), so children that poll a token from `stop` (see
+// the cancellable async_compute) give up early.
+//
+// The parent resumes only after every child has finished, as in when_all.
+// Losers never outlive the join, and their frames can be destroyed as soon
+// as the awaiter returns. The first child whose request_stop() call wins is
+// the winner. If stop was already requested from elsewhere, there is no
+// winner and the size of the range is returned.
+template <typename Range>
+class when_any_awaiter : join_awaiter<race_counter> {
+public:
+  when_any_awaiter(std::stop_source &stop, Range &tasks) noexcept
+      : tasks(tasks) {
+    join.stop = &stop;
+    join.arrive = &first_arrival;
+  }
+
+  bool await_ready() const noexcept { return false; }
+
+  bool await_suspend(std::coroutine_handle<> parent) noexcept {
+    open(parent, static_cast<std::size_t>(std::ranges::distance(tasks)));
+    std::size_t finished = 0;
+    for (auto &t : tasks) {
+      if (!attach(t.promise())) {
+        first_arrival(&join, &t.promise());
+        ++finished;
+      }
+    }
+    return close(finished);
+  }
+
+  std::size_t await_resume() const noexcept {
+    std::size_t index = 0;
+    for (auto &t : tasks) {
+      if (&t.promise() == join.winner) {
+        break;
+      }
+      ++index;
+    }
+    return index;
+  }
+
+private:
+  // Runs once per child, before it counts down. Only the first successful
+  // stop request records a winner, so `winner` is written at most once and
+  // reaches the parent through the countdown.
+  static void first_arrival(join_counter *counter, void *promise) noexcept {
+    auto *race = static_cast<race_counter *>(counter);
+    if (race->stop->request_stop()) {
+      race->winner = promise;
+    }
+  }
+
+  Range &tasks;
+};
+
+template <std::ranges::forward_range Range>
+when_any_awaiter<Range> when_any(std::stop_source &stop, Range &tasks) {
+  return when_any_awaiter<Range>(stop, tasks);
+}
+
+} // namespace async_coro_atomic
@@ -0,0 +1,232 @@
+#pragma once
+
+#include <affinity.hpp>
+#include <atomic>
+#include <chase_lev_deque.hpp>
+#include <coroutine>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <numa_topology.hpp>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace corobench {
+
+// Runs one queued coroutine. Items of other pools provide their own
+// execute() overload, found by argument-dependent lookup.
+inline void execute(std::coroutine_handle<> h) { h.resume(); }
+
+// Thread pool with per-worker Chase-Lev deques of trivially copyable items.
+// submit() from a worker pushes onto that worker's own deque; from any other
+// thread it goes through a shared injection queue. A worker pops its own
+// deque LIFO, then drains the injection queue, then steals FIFO from the
+// other workers starting at a random victim. In placement mode the workers
+// are pinned and victims on the stealing worker's own NUMA node come first.
+//
+// Idle workers sleep on an epoch counter. A worker announces itself idle,
+// re-checks every queue and only then waits, while submit() publishes the
+// work before looking for idle workers; the seq_cst fences on both sides
+// guarantee that at least one of them sees the other, so no wakeup is lost.
+template <typename Item> class basic_work_stealing_pool {
+public:
+  explicit basic_work_stealing_pool(std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i) {
+      workers.push_back(std::make_unique<worker>());
+    }
+    start();
+  }
+
+  // Placement mode: worker i is pinned to the i-th allowed CPU, filling one
+  // NUMA node before the next, and steals from workers on its own node
+  // before trying any other node
+  basic_work_stealing_pool(std::size_t count, const numa_topology &topology) {
+    std::vector<int> cpus = topology.cpus_by_node();
+    for (std::size_t i = 0; i < count; ++i) {
+      auto w = std::make_unique<worker>();
+      if (!cpus.empty()) {
+        w->cpu = cpus[i % cpus.size()];
+        w->node = topology.node_of(w->cpu);
+      }
+      workers.push_back(std::move(w));
+    }
+    start();
+  }
+
+  ~basic_work_stealing_pool() {
+    stop.store(true, std::memory_order_relaxed);
+    epoch.fetch_add(1, std::memory_order_release);
+    epoch.notify_all();
+    for (auto &w : workers) {
+      w->thread.join();
+    }
+  }
+
+  basic_work_stealing_pool(const basic_work_stealing_pool &) = delete;
+  basic_work_stealing_pool &
+  operator=(const basic_work_stealing_pool &) = delete;
+
+  void submit(Item item) {
+    if (current.pool == this) {
+      workers[current.index]->deque.push(item);
+    } else {
+      std::lock_guard<std::mutex> lock(injection_mutex);
+      injection.push_back(item);
+      injected.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    if (idle.load(std::memory_order_relaxed) != 0) {
+      epoch.fetch_add(1, std::memory_order_release);
+      epoch.notify_one();
+    }
+  }
+
+  std::size_t size() const noexcept { return workers.size(); }
+
+private:
+  struct worker {
+    chase_lev_deque<Item> deque;
+    std::thread thread;
+    int cpu = -1;  // -1: unpinned
+    int node = -1; // -1: unknown, every other worker counts as near
+    std::vector<std::size_t> near;
+    std::vector<std::size_t> far;
+  };
+
+  // The worker the calling thread runs, if it belongs to a pool
+  struct context {
+    basic_work_stealing_pool *pool;
+    std::size_t index;
+  };
+
+  // Sorts the other workers into steal-first (same node) and steal-later,
+  // then starts the threads
+  void start() {
+    for (std::size_t i = 0; i < workers.size(); ++i) {
+      for (std::size_t j = 0; j < workers.size(); ++j) {
+        if (j == i) {
+          continue;
+        }
+        bool same_node = workers[i]->node < 0 ||
+                         workers[i]->node == workers[j]->node;
+        (same_node ? workers[i]->near : workers[i]->far).push_back(j);
+      }
+    }
+    for (std::size_t i = 0; i < workers.size(); ++i) {
+      workers[i]->thread = std::thread([this, i] {
+        pin_scope pin(workers[i]->cpu);
+        run(i);
+      });
+    }
+  }
+
+  std::optional<Item> take_injected() {
+    if (injected.load(std::memory_order_relaxed) == 0) {
+      return std::nullopt;
+    }
+    std::lock_guard<std::mutex> lock(injection_mutex);
+    if (injection.empty()) {
+      return std::nullopt;
+    }
+    Item item = injection.front();
+    injection.pop_front();
+    injected.fetch_sub(1, std::memory_order_relaxed);
+    return item;
+  }
+
+  std::optional<Item> find_work(std::size_t index, std::uint32_t &seed) {
+    if (auto item = workers[index]->deque.pop()) {
+      return item;
+    }
+    if (auto item = take_injected()) {
+      return item;
+    }
+
+    if (auto item = steal_from(workers[index]->near, seed)) {
+      return item;
+    }
+    return steal_from(workers[index]->far, seed);
+  }
+
+  std::optional<Item> steal_from(const std::vector<std::size_t> &victims,
+                                 std::uint32_t &seed) {
+    std::size_t n = victims.size();
+    if (n == 0) {
+      return std::nullopt;
+    }
+    // xorshift32 picks the first victim; the rest follow in order
+    seed ^= seed << 13;
+    seed ^= seed >> 17;
+    seed ^= seed << 5;
+    std::size_t first = seed % n;
+    for (std::size_t k = 0; k < n; ++k) {
+      if (auto item = workers[victims[(first + k) % n]]->deque.steal()) {
+        return item;
+      }
+    }
+    return std::nullopt;
+  }
+
+  void run(std::size_t index) {
+    current = {this, index};
+    std::uint32_t seed = static_cast<std::uint32_t>(index) * 2654435761u + 1;
+
+    while (!stop.load(std::memory_order_relaxed)) {
+      if (auto item = find_work(index, seed)) {
+        execute(*item);
+        continue;
+      }
+
+      std::uint32_t observed = epoch.load(std::memory_order_acquire);
+      idle.fetch_add(1, std::memory_order_relaxed);
+      std::atomic_thread_fence(std::memory_order_seq_cst);
+      if (auto item = find_work(index, seed)) {
+        idle.fetch_sub(1, std::memory_order_relaxed);
+        execute(*item);
+        continue;
+      }
+      if (!stop.load(std::memory_order_relaxed)) {
+        epoch.wait(observed, std::memory_order_acquire);
+      }
+      idle.fetch_sub(1, std::memory_order_relaxed);
+    }
+    current = {};
+  }
+
+  std::vector<std::unique_ptr<worker>> workers;
+
+  std::mutex injection_mutex;
+  std::deque<Item> injection;
+  std::atomic<std::size_t> injected{0};
+
+  alignas(64) std::atomic<std::uint32_t> epoch{0};
+  std::atomic<std::uint32_t> idle{0};
+  std::atomic<bool> stop{false};
+
+  static inline thread_local constinit context current{};
+};
+
+// Pool of coroutine handles: co_await schedule() continues on a worker
+class work_stealing_pool
+    : public basic_work_stealing_pool<std::coroutine_handle<>> {
+public:
+  using basic_work_stealing_pool::basic_work_stealing_pool;
+
+  struct schedule_awaiter {
+    work_stealing_pool &pool;
+
+    bool await_ready() const noexcept { return false; }
+
+    void await_suspend(std::coroutine_handle<> h) { pool.submit(h); }
+
+    void await_resume() const noexcept {}
+  };
+
+  schedule_awaiter schedule() noexcept { return {*this}; }
+};
+
+} // namespace corobench
@@ -0,0 +1,177 @@
+// Replacement global allocation functions that count every heap block.
+// Only compiled in with -DCOROBENCH_COUNT_ALLOCATIONS=ON, since the atomic
+// increments add a few nanoseconds to every allocation being measured.
+
+#include <atomic>
+#include <counters.hpp>
+#include <cstdlib>
+#include <new>
+
+#ifdef COROBENCH_TRACK_PEAK_BYTES
+#include <malloc.h>
+#endif
+
+namespace {
+
+std::atomic<std::uint64_t> total_allocs{0};
+std::atomic<std::uint64_t> total_frees{0};
+std::atomic<std::uint64_t> total_bytes{0};
+
+#ifdef COROBENCH_TRACK_PEAK_BYTES
+std::atomic<std::uint64_t> live_bytes{0};
+std::atomic<std::uint64_t> peak_bytes{0};
+
+void track_live(void *ptr) noexcept {
+  if (!ptr) {
+    return;
+  }
+  std::uint64_t usable = malloc_usable_size(ptr);
+  std::uint64_t live =
+      live_bytes.fetch_add(usable, std::memory_order_relaxed) + usable;
+  std::uint64_t peak = peak_bytes.load(std::memory_order_relaxed);
+  while (live > peak && !peak_bytes.compare_exchange_weak(
+                            peak, live, std::memory_order_relaxed)) {
+  }
+}
+
+void track_free(void *ptr) noexcept {
+  live_bytes.fetch_sub(malloc_usable_size(ptr), std::memory_order_relaxed);
+}
+#else
+void track_live(void *) noexcept {}
+
+void track_free(void *) noexcept {}
+#endif
+
+void *counted_alloc(std::size_t size) noexcept {
+  total_allocs.fetch_add(1, std::memory_order_relaxed);
+  total_bytes.fetch_add(size, std::memory_order_relaxed);
+  void *ptr = std::malloc(size ? size : 1);
+  track_live(ptr);
+  return ptr;
+}
+
+void *counted_aligned_alloc(std::size_t size, std::align_val_t al) noexcept {
+  auto align = static_cast<std::size_t>(al);
+  total_allocs.fetch_add(1, std::memory_order_relaxed);
+  total_bytes.fetch_add(size, std::memory_order_relaxed);
+  // aligned_alloc requires the size to be a multiple of the alignment
+  std::size_t rounded = (size + align - 1) / align * align;
+  void *ptr = std::aligned_alloc(align, rounded ? rounded : align);
+  track_live(ptr);
+  return ptr;
+}
+
+void counted_free(void *ptr) noexcept {
+  if (ptr) {
+    total_frees.fetch_add(1, std::memory_order_relaxed);
+    track_free(ptr);
+    std::free(ptr);
+  }
+}
+
+void *checked(void *ptr) {
+  if (!ptr) {
+    throw std::bad_alloc();
+  }
+  return ptr;
+}
+
+} // namespace
+
+namespace corobench {
+
+alloc_totals alloc_snapshot() noexcept {
+  return {total_allocs.load(std::memory_order_relaxed),
+          total_frees.load(std::memory_order_relaxed),
+          total_bytes.load(std::memory_order_relaxed)};
+}
+
+#ifdef COROBENCH_TRACK_PEAK_BYTES
+std::uint64_t alloc_live_bytes() noexcept {
+  return live_bytes.load(std::memory_order_relaxed);
+}
+
+std::uint64_t alloc_peak_bytes() noexcept {
+  return peak_bytes.load(std::memory_order_relaxed);
+}
+
+void reset_alloc_peak() noexcept {
+  peak_bytes.store(live_bytes.load(std::memory_order_relaxed),
+                   std::memory_order_relaxed);
+}
+#endif
+
+} // namespace corobench
+
+void *operator new(std::size_t size) { return checked(counted_alloc(size)); }
+
+void *operator new[](std::size_t size) { return checked(counted_alloc(size)); }
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept {
+  return counted_alloc(size);
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept {
+  return counted_alloc(size);
+}
+
+void *operator new(std::size_t size, std::align_val_t align) {
+  return checked(counted_aligned_alloc(size, align));
+}
+
+void *operator new[](std::size_t size, std::align_val_t align) {
+  return checked(counted_aligned_alloc(size, align));
+}
+
+void *operator new(std::size_t size, std::align_val_t align,
+                   const std::nothrow_t &) noexcept {
+  return counted_aligned_alloc(size, align);
+}
+
+void *operator new[](std::size_t size, std::align_val_t align,
+                     const std::nothrow_t &) noexcept {
+  return counted_aligned_alloc(size, align);
+}
+
+void operator delete(void *ptr) noexcept { counted_free(ptr); }
+
+void operator delete[](void *ptr) noexcept { counted_free(ptr); }
+
+void operator delete(void *ptr, std::size_t) noexcept { counted_free(ptr); }
+
+void operator delete[](void *ptr, std::size_t) noexcept { counted_free(ptr); }
+
+void operator delete(void *ptr, const std::nothrow_t &) noexcept {
+  counted_free(ptr);
+}
+
+void operator delete[](void *ptr, const std::nothrow_t &) noexcept {
+  counted_free(ptr);
+}
+
+void operator delete(void *ptr, std::align_val_t) noexcept {
+  counted_free(ptr);
+}
+
+void operator delete[](void *ptr, std::align_val_t) noexcept {
+  counted_free(ptr);
+}
+
+void operator delete(void *ptr, std::size_t, std::align_val_t) noexcept {
+  counted_free(ptr);
+}
+
+void operator delete[](void *ptr, std::size_t, std::align_val_t) noexcept {
+  counted_free(ptr);
+}
+
+void operator delete(void *ptr, std::align_val_t,
+                     const std::nothrow_t &) noexcept {
+  counted_free(ptr);
+}
+
+void operator delete[](void *ptr, std::align_val_t,
+                       const std::nothrow_t &) noexcept {
+  counted_free(ptr);
+}
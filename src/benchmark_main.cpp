@@ -1,7 +1,61 @@
+#include <algorithm>
+#include <atomic>
 #include <benchmark/benchmark.h>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <memory_resource>
+#include <numeric>
+#include <random>
+#include <stop_token>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <utility>
+#include <vector>
+#include <arena.hpp>
+#include <async_generator.hpp>
+#include <async_scope.hpp>
 #include <callback.hpp>
+#include <callback_function_ref.hpp>
+#include <callback_inplace.hpp>
+#include <callback_pool.hpp>
+#include <callback_static.hpp>
+#include <coroutine>
 #include <coroutine.hpp>
+#include <coroutine_arena.hpp>
+#include <coroutine_atomic.hpp>
+#include <coroutine_lazy.hpp>
+#include <coroutine_numa.hpp>
 #include <coroutine_optimized.hpp>
+#include <coroutine_pmr.hpp>
+#include <coroutine_pooled.hpp>
+#include <coroutine_remote.hpp>
+#include <coroutine_stoppable.hpp>
+#include <counters.hpp>
+#include <frame_stats.hpp>
+#include <hop_threads.hpp>
+#include <numa_frame_pool.hpp>
+#include <numa_topology.hpp>
+#include <ping_pong.hpp>
+#include <priority_scheduler.hpp>
+#include <resume_queue.hpp>
+#include <run_loop.hpp>
+#include <spsc_queue.hpp>
+#include <timing_wheel.hpp>
+#include <when_all.hpp>
+#include <when_any.hpp>
+#include <work_stealing_pool.hpp>
+
+// std::move_only_function needs a C++23 standard library
+#include <version>
+#if defined(__cpp_lib_move_only_function)
+#define ENABLE_MOVE_ONLY_FUNCTION_BENCHMARKS
+#include <callback_move_only.hpp>
+#endif
 
 // Only include elidable benchmarks if the decorator is actually being used
 #if defined(__clang__) && !defined(__apple_build_version__)
@@ -10,11 +64,25 @@
 #include <coroutine_optimized_elidable.hpp>
 #endif
 
+// io_uring is Linux-only; the benchmarks skip themselves if setup is refused
+#if defined(__linux__) && __has_include(<linux/io_uring.h>)
+#define ENABLE_IO_URING_BENCHMARKS
+#include <io_uring_reactor.hpp>
+#endif
+
+#if defined(__linux__)
+#define ENABLE_EPOLL_BENCHMARKS
+#include <epoll_reactor.hpp>
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
 // ============================================================================
 // SIMPLE OPERATIONS - Single async computation (workload=1000)
 // ============================================================================
 
 static void BM_Simple_Callback(benchmark::State &state) {
+  corobench::scoped_counters counters(state);
   for (auto _ : state) {
     int result = 0;
     async_callback::async_compute<int>(1000,
@@ -24,7 +92,54 @@ static void BM_Simple_Callback(benchmark::State &state) {
 }
 BENCHMARK(BM_Simple_Callback);
 
+#ifdef ENABLE_MOVE_ONLY_FUNCTION_BENCHMARKS
+static void BM_Simple_CallbackMoveOnly(benchmark::State &state) {
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    int result = 0;
+    async_callback_move_only::async_compute<int>(
+        1000, [&result](int val) { result = val; });
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_Simple_CallbackMoveOnly);
+#endif
+
+static void BM_Simple_CallbackRef(benchmark::State &state) {
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    int result = 0;
+    async_callback_ref::async_compute<int>(
+        1000, [&result](int val) { result = val; });
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_Simple_CallbackRef);
+
+static void BM_Simple_CallbackInplace(benchmark::State &state) {
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    int result = 0;
+    async_callback_inplace::async_compute<int>(
+        1000, [&result](int val) { result = val; });
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_Simple_CallbackInplace);
+
+static void BM_Simple_CallbackStatic(benchmark::State &state) {
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    int result = 0;
+    async_callback_static::async_compute<int>(
+        1000, [&result](int val) { result = val; });
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_Simple_CallbackStatic);
+
 static void BM_Simple_Coroutine(benchmark::State &state) {
+  corobench::scoped_counters counters(state);
   for (auto _ : state) {
     auto task = async_coro::async_compute(1000);
     int result = task.get();
@@ -34,6 +149,7 @@ static void BM_Simple_Coroutine(benchmark::State &state) {
 BENCHMARK(BM_Simple_Coroutine);
 
 static void BM_Simple_CoroOptimized(benchmark::State &state) {
+  corobench::scoped_counters counters(state);
   for (auto _ : state) {
     auto task = async_coro_opt::async_compute(1000);
     int result = task.get();
@@ -42,8 +158,30 @@ static void BM_Simple_CoroOptimized(benchmark::State &state) {
 }
 BENCHMARK(BM_Simple_CoroOptimized);
 
+static void BM_Simple_CoroPooled(benchmark::State &state) {
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    auto task = async_coro_pooled::async_compute(1000);
+    int result = task.get();
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_Simple_CoroPooled);
+
+static void BM_Simple_CoroLazy(benchmark::State &state) {
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    auto task = async_coro_lazy::async_compute(1000);
+    task.start();
+    int result = task.get();
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_Simple_CoroLazy);
+
 #ifdef ENABLE_ELIDABLE_BENCHMARKS
 static void BM_Simple_CoroElidable(benchmark::State &state) {
+  corobench::scoped_counters counters(state);
   for (auto _ : state) {
     auto task = async_coro_elidable::async_compute(1000);
     int result = task.get();
@@ -53,6 +191,7 @@ static void BM_Simple_CoroElidable(benchmark::State &state) {
 BENCHMARK(BM_Simple_CoroElidable);
 
 static void BM_Simple_CoroOptElidable(benchmark::State &state) {
+  corobench::scoped_counters counters(state);
   for (auto _ : state) {
     auto task = async_coro_opt_elidable::async_compute(1000);
     int result = task.get();
@@ -67,6 +206,7 @@ BENCHMARK(BM_Simple_CoroOptElidable);
 // ============================================================================
 
 static void BM_Chain_Callback(benchmark::State &state) {
+  corobench::scoped_counters counters(state);
   for (auto _ : state) {
     int result = 0;
     async_callback::async_chain<int>(1000,
@@ -76,7 +216,54 @@ static void BM_Chain_Callback(benchmark::State &state) {
 }
 BENCHMARK(BM_Chain_Callback);
 
+#ifdef ENABLE_MOVE_ONLY_FUNCTION_BENCHMARKS
+static void BM_Chain_CallbackMoveOnly(benchmark::State &state) {
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    int result = 0;
+    async_callback_move_only::async_chain<int>(
+        1000, [&result](int val) { result = val; });
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_Chain_CallbackMoveOnly);
+#endif
+
+static void BM_Chain_CallbackRef(benchmark::State &state) {
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    int result = 0;
+    async_callback_ref::async_chain<int>(1000,
+                                         [&result](int val) { result = val; });
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_Chain_CallbackRef);
+
+static void BM_Chain_CallbackInplace(benchmark::State &state) {
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    int result = 0;
+    async_callback_inplace::async_chain<int>(
+        1000, [&result](int val) { result = val; });
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_Chain_CallbackInplace);
+
+static void BM_Chain_CallbackStatic(benchmark::State &state) {
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    int result = 0;
+    async_callback_static::async_chain<int>(
+        1000, [&result](int val) { result = val; });
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_Chain_CallbackStatic);
+
 static void BM_Chain_Coroutine(benchmark::State &state) {
+  corobench::scoped_counters counters(state);
   for (auto _ : state) {
     auto task = async_coro::async_chain(1000);
     int result = task.get();
@@ -86,6 +273,7 @@ static void BM_Chain_Coroutine(benchmark::State &state) {
 BENCHMARK(BM_Chain_Coroutine);
 
 static void BM_Chain_CoroOptimized(benchmark::State &state) {
+  corobench::scoped_counters counters(state);
   for (auto _ : state) {
     auto task = async_coro_opt::async_chain(1000);
     int result = task.get();
@@ -94,8 +282,30 @@ static void BM_Chain_CoroOptimized(benchmark::State &state) {
 }
 BENCHMARK(BM_Chain_CoroOptimized);
 
+static void BM_Chain_CoroPooled(benchmark::State &state) {
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    auto task = async_coro_pooled::async_chain(1000);
+    int result = task.get();
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_Chain_CoroPooled);
+
+static void BM_Chain_CoroLazy(benchmark::State &state) {
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    auto task = async_coro_lazy::async_chain(1000);
+    task.start();
+    int result = task.get();
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_Chain_CoroLazy);
+
 #ifdef ENABLE_ELIDABLE_BENCHMARKS
 static void BM_Chain_CoroElidable(benchmark::State &state) {
+  corobench::scoped_counters counters(state);
   for (auto _ : state) {
     auto task = async_coro_elidable::async_chain(1000);
     int result = task.get();
@@ -105,6 +315,7 @@ static void BM_Chain_CoroElidable(benchmark::State &state) {
 BENCHMARK(BM_Chain_CoroElidable);
 
 static void BM_Chain_CoroOptElidable(benchmark::State &state) {
+  corobench::scoped_counters counters(state);
   for (auto _ : state) {
     auto task = async_coro_opt_elidable::async_chain(1000);
     int result = task.get();
@@ -119,6 +330,7 @@ BENCHMARK(BM_Chain_CoroOptElidable);
 // ============================================================================
 
 static void BM_ComplexChain_Callback(benchmark::State &state) {
+  corobench::scoped_counters counters(state);
   for (auto _ : state) {
     int result = 0;
     async_callback::async_complex_chain<int>(
@@ -128,7 +340,54 @@ static void BM_ComplexChain_Callback(benchmark::State &state) {
 }
 BENCHMARK(BM_ComplexChain_Callback);
 
+#ifdef ENABLE_MOVE_ONLY_FUNCTION_BENCHMARKS
+static void BM_ComplexChain_CallbackMoveOnly(benchmark::State &state) {
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    int result = 0;
+    async_callback_move_only::async_complex_chain<int>(
+        1000, [&result](int val) { result = val; });
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_ComplexChain_CallbackMoveOnly);
+#endif
+
+static void BM_ComplexChain_CallbackRef(benchmark::State &state) {
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    int result = 0;
+    async_callback_ref::async_complex_chain<int>(
+        1000, [&result](int val) { result = val; });
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_ComplexChain_CallbackRef);
+
+static void BM_ComplexChain_CallbackInplace(benchmark::State &state) {
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    int result = 0;
+    async_callback_inplace::async_complex_chain<int>(
+        1000, [&result](int val) { result = val; });
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_ComplexChain_CallbackInplace);
+
+static void BM_ComplexChain_CallbackStatic(benchmark::State &state) {
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    int result = 0;
+    async_callback_static::async_complex_chain<int>(
+        1000, [&result](int val) { result = val; });
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_ComplexChain_CallbackStatic);
+
 static void BM_ComplexChain_Coroutine(benchmark::State &state) {
+  corobench::scoped_counters counters(state);
   for (auto _ : state) {
     auto task = async_coro::async_complex_chain(1000);
     int result = task.get();
@@ -138,6 +397,7 @@ static void BM_ComplexChain_Coroutine(benchmark::State &state) {
 BENCHMARK(BM_ComplexChain_Coroutine);
 
 static void BM_ComplexChain_CoroOptimized(benchmark::State &state) {
+  corobench::scoped_counters counters(state);
   for (auto _ : state) {
     auto task = async_coro_opt::async_complex_chain(1000);
     int result = task.get();
@@ -146,8 +406,30 @@ static void BM_ComplexChain_CoroOptimized(benchmark::State &state) {
 }
 BENCHMARK(BM_ComplexChain_CoroOptimized);
 
+static void BM_ComplexChain_CoroPooled(benchmark::State &state) {
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    auto task = async_coro_pooled::async_complex_chain(1000);
+    int result = task.get();
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_ComplexChain_CoroPooled);
+
+static void BM_ComplexChain_CoroLazy(benchmark::State &state) {
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    auto task = async_coro_lazy::async_complex_chain(1000);
+    task.start();
+    int result = task.get();
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_ComplexChain_CoroLazy);
+
 #ifdef ENABLE_ELIDABLE_BENCHMARKS
 static void BM_ComplexChain_CoroElidable(benchmark::State &state) {
+  corobench::scoped_counters counters(state);
   for (auto _ : state) {
     auto task = async_coro_elidable::async_complex_chain(1000);
     int result = task.get();
@@ -157,6 +439,7 @@ static void BM_ComplexChain_CoroElidable(benchmark::State &state) {
 BENCHMARK(BM_ComplexChain_CoroElidable);
 
 static void BM_ComplexChain_CoroOptElidable(benchmark::State &state) {
+  corobench::scoped_counters counters(state);
   for (auto _ : state) {
     auto task = async_coro_opt_elidable::async_complex_chain(1000);
     int result = task.get();
@@ -172,6 +455,7 @@ BENCHMARK(BM_ComplexChain_CoroOptElidable);
 
 static void BM_VaryingLoad_Callback(benchmark::State &state) {
   int workload = state.range(0);
+  corobench::scoped_counters counters(state);
   for (auto _ : state) {
     int result = 0;
     async_callback::async_compute<int>(workload,
@@ -181,8 +465,21 @@ static void BM_VaryingLoad_Callback(benchmark::State &state) {
 }
 BENCHMARK(BM_VaryingLoad_Callback)->Range(8, 8 << 10);
 
+static void BM_VaryingLoad_CallbackStatic(benchmark::State &state) {
+  int workload = state.range(0);
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    int result = 0;
+    async_callback_static::async_compute<int>(
+        workload, [&result](int val) { result = val; });
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_VaryingLoad_CallbackStatic)->Range(8, 8 << 10);
+
 static void BM_VaryingLoad_Coroutine(benchmark::State &state) {
   int workload = state.range(0);
+  corobench::scoped_counters counters(state);
   for (auto _ : state) {
     auto task = async_coro::async_compute(workload);
     int result = task.get();
@@ -193,6 +490,7 @@ BENCHMARK(BM_VaryingLoad_Coroutine)->Range(8, 8 << 10);
 
 static void BM_VaryingLoad_CoroOptimized(benchmark::State &state) {
   int workload = state.range(0);
+  corobench::scoped_counters counters(state);
   for (auto _ : state) {
     auto task = async_coro_opt::async_compute(workload);
     int result = task.get();
@@ -201,9 +499,33 @@ static void BM_VaryingLoad_CoroOptimized(benchmark::State &state) {
 }
 BENCHMARK(BM_VaryingLoad_CoroOptimized)->Range(8, 8 << 10);
 
+static void BM_VaryingLoad_CoroPooled(benchmark::State &state) {
+  int workload = state.range(0);
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    auto task = async_coro_pooled::async_compute(workload);
+    int result = task.get();
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_VaryingLoad_CoroPooled)->Range(8, 8 << 10);
+
+static void BM_VaryingLoad_CoroLazy(benchmark::State &state) {
+  int workload = state.range(0);
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    auto task = async_coro_lazy::async_compute(workload);
+    task.start();
+    int result = task.get();
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_VaryingLoad_CoroLazy)->Range(8, 8 << 10);
+
 #ifdef ENABLE_ELIDABLE_BENCHMARKS
 static void BM_VaryingLoad_CoroElidable(benchmark::State &state) {
   int workload = state.range(0);
+  corobench::scoped_counters counters(state);
   for (auto _ : state) {
     auto task = async_coro_elidable::async_compute(workload);
     int result = task.get();
@@ -214,6 +536,7 @@ BENCHMARK(BM_VaryingLoad_CoroElidable)->Range(8, 8 << 10);
 
 static void BM_VaryingLoad_CoroOptElidable(benchmark::State &state) {
   int workload = state.range(0);
+  corobench::scoped_counters counters(state);
   for (auto _ : state) {
     auto task = async_coro_opt_elidable::async_compute(workload);
     int result = task.get();
@@ -223,4 +546,2086 @@ static void BM_VaryingLoad_CoroOptElidable(benchmark::State &state) {
 BENCHMARK(BM_VaryingLoad_CoroOptElidable)->Range(8, 8 << 10);
 #endif
 
-BENCHMARK_MAIN();
\ No newline at end of file
+// ============================================================================
+// ARENA ALLOCATION - Whole chains allocated from a caller-owned stack buffer
+// ============================================================================
+
+static void BM_Chain_CoroArenaHeap(benchmark::State &state) {
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    auto task = async_coro_arena::async_chain(
+        std::allocator_arg, std::allocator<std::byte>{}, 1000);
+    int result = task.get();
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_Chain_CoroArenaHeap);
+
+static void BM_Chain_CoroArena(benchmark::State &state) {
+  alignas(std::max_align_t) std::byte buffer[4096];
+  corobench::monotonic_arena arena(buffer);
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    {
+      auto task = async_coro_arena::async_chain(
+          std::allocator_arg, corobench::arena_allocator<std::byte>(arena),
+          1000);
+      int result = task.get();
+      benchmark::DoNotOptimize(result);
+    }
+    arena.reset();
+  }
+}
+BENCHMARK(BM_Chain_CoroArena);
+
+static void BM_ComplexChain_CoroArenaHeap(benchmark::State &state) {
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    auto task = async_coro_arena::async_complex_chain(
+        std::allocator_arg, std::allocator<std::byte>{}, 1000);
+    int result = task.get();
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_ComplexChain_CoroArenaHeap);
+
+static void BM_ComplexChain_CoroArena(benchmark::State &state) {
+  alignas(std::max_align_t) std::byte buffer[4096];
+  corobench::monotonic_arena arena(buffer);
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    {
+      auto task = async_coro_arena::async_complex_chain(
+          std::allocator_arg, corobench::arena_allocator<std::byte>(arena),
+          1000);
+      int result = task.get();
+      benchmark::DoNotOptimize(result);
+    }
+    arena.reset();
+  }
+}
+BENCHMARK(BM_ComplexChain_CoroArena);
+
+// ============================================================================
+// PMR MEMORY RESOURCES - Frame storage from std::pmr::memory_resource
+// ============================================================================
+
+static void BM_Simple_CoroPmrNewDelete(benchmark::State &state) {
+  auto *resource = std::pmr::new_delete_resource();
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    auto task =
+        async_coro_pmr::async_compute(std::allocator_arg, resource, 1000);
+    int result = task.get();
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_Simple_CoroPmrNewDelete);
+
+static void BM_Simple_CoroPmrMonotonic(benchmark::State &state) {
+  alignas(std::max_align_t) std::byte buffer[4096];
+  std::pmr::monotonic_buffer_resource resource(
+      buffer, sizeof(buffer), std::pmr::null_memory_resource());
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    {
+      auto task =
+          async_coro_pmr::async_compute(std::allocator_arg, &resource, 1000);
+      int result = task.get();
+      benchmark::DoNotOptimize(result);
+    }
+    resource.release();
+  }
+}
+BENCHMARK(BM_Simple_CoroPmrMonotonic);
+
+static void BM_Simple_CoroPmrUnsyncPool(benchmark::State &state) {
+  std::pmr::unsynchronized_pool_resource resource;
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    auto task =
+        async_coro_pmr::async_compute(std::allocator_arg, &resource, 1000);
+    int result = task.get();
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_Simple_CoroPmrUnsyncPool);
+
+static void BM_Simple_CoroPmrSyncPool(benchmark::State &state) {
+  std::pmr::synchronized_pool_resource resource;
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    auto task =
+        async_coro_pmr::async_compute(std::allocator_arg, &resource, 1000);
+    int result = task.get();
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_Simple_CoroPmrSyncPool);
+
+static void BM_Chain_CoroPmrNewDelete(benchmark::State &state) {
+  auto *resource = std::pmr::new_delete_resource();
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    auto task = async_coro_pmr::async_chain(std::allocator_arg, resource, 1000);
+    int result = task.get();
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_Chain_CoroPmrNewDelete);
+
+static void BM_Chain_CoroPmrMonotonic(benchmark::State &state) {
+  alignas(std::max_align_t) std::byte buffer[4096];
+  std::pmr::monotonic_buffer_resource resource(
+      buffer, sizeof(buffer), std::pmr::null_memory_resource());
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    {
+      auto task =
+          async_coro_pmr::async_chain(std::allocator_arg, &resource, 1000);
+      int result = task.get();
+      benchmark::DoNotOptimize(result);
+    }
+    resource.release();
+  }
+}
+BENCHMARK(BM_Chain_CoroPmrMonotonic);
+
+static void BM_Chain_CoroPmrUnsyncPool(benchmark::State &state) {
+  std::pmr::unsynchronized_pool_resource resource;
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    auto task =
+        async_coro_pmr::async_chain(std::allocator_arg, &resource, 1000);
+    int result = task.get();
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_Chain_CoroPmrUnsyncPool);
+
+static void BM_Chain_CoroPmrSyncPool(benchmark::State &state) {
+  std::pmr::synchronized_pool_resource resource;
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    auto task =
+        async_coro_pmr::async_chain(std::allocator_arg, &resource, 1000);
+    int result = task.get();
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_Chain_CoroPmrSyncPool);
+
+static void BM_ComplexChain_CoroPmrNewDelete(benchmark::State &state) {
+  auto *resource = std::pmr::new_delete_resource();
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    auto task =
+        async_coro_pmr::async_complex_chain(std::allocator_arg, resource, 1000);
+    int result = task.get();
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_ComplexChain_CoroPmrNewDelete);
+
+static void BM_ComplexChain_CoroPmrMonotonic(benchmark::State &state) {
+  alignas(std::max_align_t) std::byte buffer[4096];
+  std::pmr::monotonic_buffer_resource resource(
+      buffer, sizeof(buffer), std::pmr::null_memory_resource());
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    {
+      auto task = async_coro_pmr::async_complex_chain(
+          std::allocator_arg, &resource, 1000);
+      int result = task.get();
+      benchmark::DoNotOptimize(result);
+    }
+    resource.release();
+  }
+}
+BENCHMARK(BM_ComplexChain_CoroPmrMonotonic);
+
+static void BM_ComplexChain_CoroPmrUnsyncPool(benchmark::State &state) {
+  std::pmr::unsynchronized_pool_resource resource;
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    auto task = async_coro_pmr::async_complex_chain(
+        std::allocator_arg, &resource, 1000);
+    int result = task.get();
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_ComplexChain_CoroPmrUnsyncPool);
+
+static void BM_ComplexChain_CoroPmrSyncPool(benchmark::State &state) {
+  std::pmr::synchronized_pool_resource resource;
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    auto task = async_coro_pmr::async_complex_chain(
+        std::allocator_arg, &resource, 1000);
+    int result = task.get();
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_ComplexChain_CoroPmrSyncPool);
+
+// No allocator argument: frames come from the thread-local default, which a
+// resource_scope points at a pool for the duration of the benchmark
+static void BM_Simple_CoroPmrThreadDefault(benchmark::State &state) {
+  std::pmr::unsynchronized_pool_resource resource;
+  async_coro_pmr::resource_scope scope(&resource);
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    auto task = async_coro_pmr::async_compute(1000);
+    int result = task.get();
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_Simple_CoroPmrThreadDefault);
+
+static void BM_Chain_CoroPmrThreadDefault(benchmark::State &state) {
+  std::pmr::unsynchronized_pool_resource resource;
+  async_coro_pmr::resource_scope scope(&resource);
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    auto task = async_coro_pmr::async_chain(1000);
+    int result = task.get();
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_Chain_CoroPmrThreadDefault);
+
+static void BM_ComplexChain_CoroPmrThreadDefault(benchmark::State &state) {
+  std::pmr::unsynchronized_pool_resource resource;
+  async_coro_pmr::resource_scope scope(&resource);
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    auto task = async_coro_pmr::async_complex_chain(1000);
+    int result = task.get();
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_ComplexChain_CoroPmrThreadDefault);
+
+// ============================================================================
+// CROSS-THREAD FREES - Tasks created on one thread, destroyed on another
+// ============================================================================
+
+// The benchmark thread creates tasks and hands them through an SPSC queue to
+// a consumer thread, which reads the result and destroys the frame
+template <typename Task, typename MakeTask>
+static void run_cross_thread_frees(benchmark::State &state,
+                                   MakeTask make_task) {
+  corobench::spsc_queue<Task, 1024> queue;
+  std::atomic<bool> stop{false};
+
+  std::thread consumer([&] {
+    for (;;) {
+      if (auto task = queue.try_pop()) {
+        int result = task->get();
+        benchmark::DoNotOptimize(result);
+      } else if (stop.load(std::memory_order_acquire)) {
+        while (queue.try_pop()) {
+        }
+        break;
+      } else {
+        std::this_thread::yield();
+      }
+    }
+  });
+
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    Task task = make_task();
+    while (!queue.try_push(std::move(task))) {
+      std::this_thread::yield();
+    }
+  }
+
+  stop.store(true, std::memory_order_release);
+  consumer.join();
+  state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_CrossThread_CoroOptimized(benchmark::State &state) {
+  run_cross_thread_frees<async_coro_opt::task<int>>(
+      state, [] { return async_coro_opt::async_compute(8); });
+}
+BENCHMARK(BM_CrossThread_CoroOptimized)->UseRealTime();
+
+// Every frame migrates into the consumer's thread-local freelists while the
+// producer keeps allocating fresh ones, so memory grows with iterations
+static void BM_CrossThread_CoroPooled(benchmark::State &state) {
+  run_cross_thread_frees<async_coro_pooled::task<int>>(
+      state, [] { return async_coro_pooled::async_compute(8); });
+}
+BENCHMARK(BM_CrossThread_CoroPooled)->UseRealTime();
+
+static void BM_CrossThread_CoroRemote(benchmark::State &state) {
+  run_cross_thread_frees<async_coro_remote::task<int>>(
+      state, [] { return async_coro_remote::async_compute(8); });
+}
+BENCHMARK(BM_CrossThread_CoroRemote)->UseRealTime();
+
+// ============================================================================
+// THREAD HOPS - Every async_compute completes on another thread
+// ============================================================================
+
+static void BM_HopChain_CoroAtomic(benchmark::State &state) {
+  corobench::hop_threads threads(2);
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    auto task = async_coro_atomic::async_chain(threads, 1000);
+    int result = task.get();
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_HopChain_CoroAtomic)->UseRealTime();
+
+static void BM_HopComplexChain_CoroAtomic(benchmark::State &state) {
+  corobench::hop_threads threads(2);
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    auto task = async_coro_atomic::async_complex_chain(threads, 1000);
+    int result = task.get();
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_HopComplexChain_CoroAtomic)->UseRealTime();
+
+// ============================================================================
+// RUN LOOP - Every async_compute step is queued on a single-threaded loop
+// ============================================================================
+
+static void BM_LoopChain_Callback(benchmark::State &state) {
+  corobench::run_loop loop;
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    int result = 0;
+    async_callback::async_chain<int>(loop, 1000,
+                                     [&result](int val) { result = val; });
+    loop.run();
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_LoopChain_Callback);
+
+static void BM_LoopChain_CoroLazy(benchmark::State &state) {
+  corobench::run_loop loop;
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    auto task = async_coro_lazy::async_chain(loop, 1000);
+    task.start();
+    loop.run();
+    int result = task.get();
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_LoopChain_CoroLazy);
+
+static void BM_LoopChain_CoroAtomic(benchmark::State &state) {
+  corobench::run_loop loop;
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    auto task = async_coro_atomic::async_chain(loop, 1000);
+    loop.run();
+    int result = task.get();
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_LoopChain_CoroAtomic);
+
+static void BM_LoopComplexChain_Callback(benchmark::State &state) {
+  corobench::run_loop loop;
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    int result = 0;
+    async_callback::async_complex_chain<int>(
+        loop, 1000, [&result](int val) { result = val; });
+    loop.run();
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_LoopComplexChain_Callback);
+
+static void BM_LoopComplexChain_CoroLazy(benchmark::State &state) {
+  corobench::run_loop loop;
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    auto task = async_coro_lazy::async_complex_chain(loop, 1000);
+    task.start();
+    loop.run();
+    int result = task.get();
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_LoopComplexChain_CoroLazy);
+
+static void BM_LoopComplexChain_CoroAtomic(benchmark::State &state) {
+  corobench::run_loop loop;
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    auto task = async_coro_atomic::async_complex_chain(loop, 1000);
+    loop.run();
+    int result = task.get();
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_LoopComplexChain_CoroAtomic);
+
+// ============================================================================
+// WORK STEALING - Independent tasks fanned out across a thread pool
+// ============================================================================
+
+// Worker counts 1, 2, 4, ... up to and including hardware_concurrency
+static void worker_counts(benchmark::internal::Benchmark *b) {
+  int max_workers =
+      static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+  for (int n = 1; n < max_workers; n *= 2) {
+    b->Arg(n);
+  }
+  b->Arg(max_workers);
+}
+
+// A root task on one worker starts 1024 async_compute tasks; they land on
+// that worker's deque and the others steal them
+static void BM_FanOut_CoroAtomic(benchmark::State &state) {
+  constexpr int tasks = 1024;
+  corobench::work_stealing_pool pool(static_cast<std::size_t>(state.range(0)));
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    auto task = async_coro_atomic::async_fan_out(pool, tasks, 1000);
+    int result = task.get();
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetItemsProcessed(state.iterations() * tasks);
+  state.counters["tasks/s/worker"] = benchmark::Counter(
+      static_cast<double>(state.iterations() * tasks) /
+          static_cast<double>(state.range(0)),
+      benchmark::Counter::kIsRate);
+}
+BENCHMARK(BM_FanOut_CoroAtomic)->Apply(worker_counts)->UseRealTime();
+
+// ============================================================================
+// POOL HOPS - Every async_compute step is scheduled on a work-stealing pool
+// ============================================================================
+
+// Both styles run on basic_work_stealing_pool with two workers: callbacks
+// post an intrusive node per step, coroutines queue their own handle. The
+// first step enters through the injection queue, later ones are pushed on
+// the current worker's deque where the other worker may steal them.
+
+static void BM_PoolChain_Callback(benchmark::State &state) {
+  corobench::callback_pool pool(2);
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    int result = 0;
+    std::atomic<bool> done{false};
+    async_callback::async_chain<int>(pool, 1000, [&](int val) {
+      result = val;
+      done.store(true, std::memory_order_release);
+    });
+    while (!done.load(std::memory_order_acquire)) {
+      std::this_thread::yield();
+    }
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_PoolChain_Callback)->UseRealTime();
+
+static void BM_PoolChain_CoroAtomic(benchmark::State &state) {
+  corobench::work_stealing_pool pool(2);
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    auto task = async_coro_atomic::async_chain(pool, 1000);
+    int result = task.get();
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_PoolChain_CoroAtomic)->UseRealTime();
+
+static void BM_PoolComplexChain_Callback(benchmark::State &state) {
+  corobench::callback_pool pool(2);
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    int result = 0;
+    std::atomic<bool> done{false};
+    async_callback::async_complex_chain<int>(pool, 1000, [&](int val) {
+      result = val;
+      done.store(true, std::memory_order_release);
+    });
+    while (!done.load(std::memory_order_acquire)) {
+      std::this_thread::yield();
+    }
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_PoolComplexChain_Callback)->UseRealTime();
+
+static void BM_PoolComplexChain_CoroAtomic(benchmark::State &state) {
+  corobench::work_stealing_pool pool(2);
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    auto task = async_coro_atomic::async_complex_chain(pool, 1000);
+    int result = task.get();
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(BM_PoolComplexChain_CoroAtomic)->UseRealTime();
+
+// ============================================================================
+// PING-PONG - Control handed between two pinned threads and back
+// ============================================================================
+
+// Reports the p50/p99 of latency samples in nanoseconds
+static void report_percentiles(benchmark::State &state,
+                               std::vector<std::int64_t> &samples) {
+  if (samples.empty()) {
+    return;
+  }
+  std::sort(samples.begin(), samples.end());
+  auto percentile = [&](double p) {
+    return static_cast<double>(
+        samples[static_cast<std::size_t>(p * (samples.size() - 1))]);
+  };
+  state.counters["p50_ns"] = percentile(0.50);
+  state.counters["p99_ns"] = percentile(0.99);
+}
+
+// Times every round trip and reports the p50/p99 in nanoseconds. One round
+// trip is two hops: home to remote and back.
+template <typename Item, typename RoundTrip>
+static void run_ping_pong(benchmark::State &state, RoundTrip round_trip) {
+  using clock = std::chrono::steady_clock;
+  corobench::ping_pong<Item> channel;
+  std::vector<std::int64_t> samples;
+  samples.reserve(1 << 20);
+
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    auto start = clock::now();
+    round_trip(channel);
+    auto elapsed = clock::now() - start;
+    samples.push_back(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+  }
+
+  report_percentiles(state, samples);
+  state.counters["pinned"] = channel.pinned() ? 1 : 0;
+}
+
+// Hops to the remote thread, awaits a child task there and hops back
+template <typename Task, Task (*Compute)(int)>
+static Task ping_pong_round_trip(
+    corobench::ping_pong<std::coroutine_handle<>> &channel) {
+  co_await channel.to_remote();
+  int result = co_await Compute(8);
+  co_await channel.to_home();
+  co_return result;
+}
+
+template <typename Task, Task (*Compute)(int)>
+static void run_coroutine_ping_pong(benchmark::State &state) {
+  run_ping_pong<std::coroutine_handle<>>(state, [](auto &channel) {
+    auto task = ping_pong_round_trip<Task, Compute>(channel);
+    channel.receive();
+    int result = task.get();
+    benchmark::DoNotOptimize(result);
+  });
+}
+
+static void BM_PingPong_Callback(benchmark::State &state) {
+  run_ping_pong<std::function<void()>>(state, [](auto &channel) {
+    int result = 0;
+    channel.send([&] {
+      async_callback::async_compute<int>(8, [&](int val) {
+        channel.reply([&result, val] { result = val; });
+      });
+    });
+    channel.receive();
+    benchmark::DoNotOptimize(result);
+  });
+}
+BENCHMARK(BM_PingPong_Callback)->UseRealTime();
+
+static void BM_PingPong_Coroutine(benchmark::State &state) {
+  run_coroutine_ping_pong<async_coro::task<int>, &async_coro::async_compute>(
+      state);
+}
+BENCHMARK(BM_PingPong_Coroutine)->UseRealTime();
+
+static void BM_PingPong_CoroOptimized(benchmark::State &state) {
+  run_coroutine_ping_pong<async_coro_opt::task<int>,
+                          &async_coro_opt::async_compute>(state);
+}
+BENCHMARK(BM_PingPong_CoroOptimized)->UseRealTime();
+
+#ifdef ENABLE_ELIDABLE_BENCHMARKS
+static void BM_PingPong_CoroElidable(benchmark::State &state) {
+  run_coroutine_ping_pong<async_coro_elidable::task<int>,
+                          &async_coro_elidable::async_compute>(state);
+}
+BENCHMARK(BM_PingPong_CoroElidable)->UseRealTime();
+
+static void BM_PingPong_CoroOptElidable(benchmark::State &state) {
+  run_coroutine_ping_pong<async_coro_opt_elidable::task<int>,
+                          &async_coro_opt_elidable::async_compute>(state);
+}
+BENCHMARK(BM_PingPong_CoroOptElidable)->UseRealTime();
+#endif
+
+#ifdef ENABLE_IO_URING_BENCHMARKS
+// ============================================================================
+// IO_URING - Completion dispatch per I/O at a given queue depth
+// ============================================================================
+
+// Each iteration queues `depth` 64-byte reads of a page-cached temporary file
+// and runs the reactor until all of them complete, so the time per I/O is
+// submission plus completion dispatch rather than device latency
+class io_uring_fixture {
+public:
+  explicit io_uring_fixture(benchmark::State &state)
+      : depth(static_cast<int>(state.range(0))),
+        buffers(static_cast<std::size_t>(depth) * block_size) {
+    if (!reactor.available()) {
+      state.SkipWithError("io_uring_setup failed");
+      return;
+    }
+    file = std::tmpfile();
+    std::vector<char> data(block_size, 'x');
+    if (!file || std::fwrite(data.data(), 1, data.size(), file) != block_size ||
+        std::fflush(file) != 0) {
+      state.SkipWithError("could not create a temporary file");
+    }
+  }
+
+  ~io_uring_fixture() {
+    if (file) {
+      std::fclose(file);
+    }
+  }
+
+  io_uring_fixture(const io_uring_fixture &) = delete;
+  io_uring_fixture &operator=(const io_uring_fixture &) = delete;
+
+  static void report(benchmark::State &state) {
+    auto ios = static_cast<double>(state.iterations() * state.range(0));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.counters["time/io"] = benchmark::Counter(
+        ios, benchmark::Counter::kIsRate | benchmark::Counter::kInvert);
+  }
+
+  char *buffer(int i) {
+    return buffers.data() + static_cast<std::size_t>(i) * block_size;
+  }
+
+  static constexpr unsigned block_size = 64;
+
+  corobench::io_uring_reactor reactor{256};
+  int depth;
+  std::vector<char> buffers;
+  std::FILE *file = nullptr;
+};
+
+template <typename Task>
+static Task io_uring_read_once(corobench::io_uring_reactor &reactor, int fd,
+                               char *buf) {
+  int n = co_await reactor.read(fd, buf, io_uring_fixture::block_size, 0);
+  co_return n;
+}
+
+template <typename Task>
+static void run_io_uring_coroutine(benchmark::State &state) {
+  io_uring_fixture io(state);
+  if (!io.file) {
+    return;
+  }
+  int fd = fileno(io.file);
+  std::vector<Task> tasks;
+  tasks.reserve(static_cast<std::size_t>(io.depth));
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    for (int i = 0; i < io.depth; ++i) {
+      tasks.push_back(io_uring_read_once<Task>(io.reactor, fd, io.buffer(i)));
+    }
+    io.reactor.run();
+    if (!io.reactor.available()) {
+      state.SkipWithError("io_uring_enter failed");
+      break;
+    }
+    int total = 0;
+    for (auto &task : tasks) {
+      total += task.get();
+    }
+    tasks.clear();
+    benchmark::DoNotOptimize(total);
+  }
+  io_uring_fixture::report(state);
+}
+
+static void BM_IoUring_Callback(benchmark::State &state) {
+  io_uring_fixture io(state);
+  if (!io.file) {
+    return;
+  }
+  int fd = fileno(io.file);
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    int total = 0;
+    for (int i = 0; i < io.depth; ++i) {
+      io.reactor.read(fd, io.buffer(i), io_uring_fixture::block_size, 0,
+                      [&total](int n) { total += n; });
+    }
+    io.reactor.run();
+    if (!io.reactor.available()) {
+      state.SkipWithError("io_uring_enter failed");
+      break;
+    }
+    benchmark::DoNotOptimize(total);
+  }
+  io_uring_fixture::report(state);
+}
+BENCHMARK(BM_IoUring_Callback)->RangeMultiplier(4)->Range(1, 256);
+
+static void BM_IoUring_Coroutine(benchmark::State &state) {
+  run_io_uring_coroutine<async_coro::task<int>>(state);
+}
+BENCHMARK(BM_IoUring_Coroutine)->RangeMultiplier(4)->Range(1, 256);
+
+static void BM_IoUring_CoroOptimized(benchmark::State &state) {
+  run_io_uring_coroutine<async_coro_opt::task<int>>(state);
+}
+BENCHMARK(BM_IoUring_CoroOptimized)->RangeMultiplier(4)->Range(1, 256);
+#endif
+
+#ifdef ENABLE_EPOLL_BENCHMARKS
+// ============================================================================
+// EPOLL ECHO - Request/response over N socketpair(AF_UNIX) connections
+// ============================================================================
+
+// Client and server ends share one epoll reactor on the benchmark thread.
+// Each iteration sends one 64-byte request on every connection and runs the
+// reactor until every echo has been read back; each request is timed from
+// its write to its response being read.
+class echo_fixture {
+public:
+  explicit echo_fixture(benchmark::State &state) {
+    if (!reactor.available()) {
+      state.SkipWithError("epoll_create1 failed");
+      return;
+    }
+    for (int64_t i = 0; i < state.range(0); ++i) {
+      int fds[2];
+      if (socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0,
+                     fds) != 0) {
+        state.SkipWithError("socketpair failed");
+        return;
+      }
+      clients.push_back(fds[0]);
+      servers.push_back(fds[1]);
+    }
+    ready = true;
+    samples.reserve(1 << 20);
+  }
+
+  ~echo_fixture() {
+    close_all(clients);
+    close_all(servers);
+  }
+
+  echo_fixture(const echo_fixture &) = delete;
+  echo_fixture &operator=(const echo_fixture &) = delete;
+
+  // Runs the reactor until `count` more responses have been recorded
+  void run_until(std::size_t count) {
+    std::size_t target = samples.size() + count;
+    while (samples.size() < target) {
+      reactor.run_once();
+    }
+  }
+
+  // Closes the client ends and lets the servers see EOF and finish
+  void shut_down() {
+    close_all(clients);
+    reactor.run();
+  }
+
+  void report(benchmark::State &state) {
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    report_percentiles(state, samples);
+  }
+
+  static constexpr std::size_t message_size = 64;
+  using clock = std::chrono::steady_clock;
+
+  corobench::epoll_reactor reactor;
+  std::vector<int> clients;
+  std::vector<int> servers;
+  std::vector<std::int64_t> samples;
+  bool ready = false;
+
+private:
+  void close_all(std::vector<int> &fds) {
+    for (int fd : fds) {
+      reactor.forget(fd);
+      close(fd);
+    }
+    fds.clear();
+  }
+};
+
+template <typename Task>
+static Task echo_server(corobench::epoll_reactor &reactor, int fd) {
+  char buf[echo_fixture::message_size];
+  for (;;) {
+    co_await reactor.readable(fd);
+    ssize_t n = read(fd, buf, sizeof(buf));
+    if (n < 0 && errno == EAGAIN) {
+      continue;
+    }
+    if (n <= 0) {
+      co_return 0;
+    }
+    // One small message per connection always fits the socket buffer
+    benchmark::DoNotOptimize(write(fd, buf, static_cast<std::size_t>(n)));
+  }
+}
+
+template <typename Task>
+static Task echo_request(echo_fixture &io, int fd) {
+  auto start = echo_fixture::clock::now();
+  char buf[echo_fixture::message_size] = {};
+  benchmark::DoNotOptimize(write(fd, buf, sizeof(buf)));
+  co_await io.reactor.readable(fd);
+  benchmark::DoNotOptimize(read(fd, buf, sizeof(buf)));
+  io.samples.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                           echo_fixture::clock::now() - start)
+                           .count());
+  co_return 0;
+}
+
+template <typename Task>
+static void run_echo_coroutine(benchmark::State &state) {
+  echo_fixture io(state);
+  if (!io.ready) {
+    return;
+  }
+  std::vector<Task> servers;
+  for (int fd : io.servers) {
+    servers.push_back(echo_server<Task>(io.reactor, fd));
+  }
+  std::vector<Task> requests;
+  requests.reserve(io.clients.size());
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    for (int fd : io.clients) {
+      requests.push_back(echo_request<Task>(io, fd));
+    }
+    io.run_until(io.clients.size());
+    requests.clear();
+  }
+  io.report(state);
+  io.shut_down();
+}
+
+static void echo_serve_callback(corobench::epoll_reactor &reactor, int fd) {
+  reactor.on_readable(fd, [&reactor, fd](std::uint32_t) {
+    char buf[echo_fixture::message_size];
+    ssize_t n = read(fd, buf, sizeof(buf));
+    if (n > 0) {
+      benchmark::DoNotOptimize(write(fd, buf, static_cast<std::size_t>(n)));
+    }
+    if (n > 0 || (n < 0 && errno == EAGAIN)) {
+      echo_serve_callback(reactor, fd);
+    }
+  });
+}
+
+static void BM_Echo_Callback(benchmark::State &state) {
+  echo_fixture io(state);
+  if (!io.ready) {
+    return;
+  }
+  for (int fd : io.servers) {
+    echo_serve_callback(io.reactor, fd);
+  }
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    for (int fd : io.clients) {
+      auto start = echo_fixture::clock::now();
+      char buf[echo_fixture::message_size] = {};
+      benchmark::DoNotOptimize(write(fd, buf, sizeof(buf)));
+      io.reactor.on_readable(fd, [&io, fd, start](std::uint32_t) {
+        char reply[echo_fixture::message_size];
+        benchmark::DoNotOptimize(read(fd, reply, sizeof(reply)));
+        io.samples.push_back(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                echo_fixture::clock::now() - start)
+                .count());
+      });
+    }
+    io.run_until(io.clients.size());
+  }
+  io.report(state);
+  io.shut_down();
+}
+BENCHMARK(BM_Echo_Callback)->Arg(1)->Arg(16)->Arg(256);
+
+static void BM_Echo_Coroutine(benchmark::State &state) {
+  run_echo_coroutine<async_coro::task<int>>(state);
+}
+BENCHMARK(BM_Echo_Coroutine)->Arg(1)->Arg(16)->Arg(256);
+
+static void BM_Echo_CoroOptimized(benchmark::State &state) {
+  run_echo_coroutine<async_coro_opt::task<int>>(state);
+}
+BENCHMARK(BM_Echo_CoroOptimized)->Arg(1)->Arg(16)->Arg(256);
+#endif
+
+// ============================================================================
+// TIMERS - Insert, cancel and expire on a hierarchical timing wheel
+// ============================================================================
+
+// Delays spread deterministically over 65536 ticks, so most timers start on
+// level 1 and cascade once before they expire
+constexpr std::uint64_t timer_span = 65536;
+
+static std::uint64_t timer_delay(std::int64_t i) {
+  return 1 + (static_cast<std::uint64_t>(i) * 2654435761u) % timer_span;
+}
+
+enum class timer_phase { insert, cancel, expire };
+
+// Times one phase per iteration; everything else runs with timing paused.
+// cancel() cancels every pending timer, release() frees what is left.
+// bytes/timer is the memory behind one pending timer: the frame bytes
+// recorded per inserted timer plus `node_bytes`, the callback node if any.
+// With COROBENCH_COUNT_ALLOCATIONS it is the heap the hooks saw allocated per
+// inserted timer instead, which includes blocks held by the callback.
+template <typename Insert, typename Cancel, typename Release>
+static void run_timers(benchmark::State &state, timer_phase phase,
+                       corobench::timing_wheel &wheel, std::size_t node_bytes,
+                       Insert insert, Cancel cancel, Release release) {
+  corobench::scoped_counters counters(state);
+  corobench::frame_stats::totals frames_start =
+      corobench::frame_stats::snapshot();
+#ifdef COROBENCH_COUNT_ALLOCATIONS
+  corobench::alloc_totals start = corobench::alloc_snapshot();
+#endif
+  for (auto _ : state) {
+    if (phase != timer_phase::insert) {
+      state.PauseTiming();
+    }
+    insert();
+    if (phase == timer_phase::insert) {
+      state.PauseTiming();
+      cancel();
+    } else {
+      state.ResumeTiming();
+      if (phase == timer_phase::cancel) {
+        cancel();
+      } else {
+        wheel.advance(timer_span);
+      }
+      state.PauseTiming();
+    }
+    release();
+    state.ResumeTiming();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  auto timers = static_cast<double>(state.iterations() * state.range(0));
+  corobench::frame_stats::totals frames_end =
+      corobench::frame_stats::snapshot();
+  double bytes =
+      static_cast<double>(frames_end.bytes - frames_start.bytes) / timers +
+      static_cast<double>(node_bytes);
+#ifdef COROBENCH_COUNT_ALLOCATIONS
+  corobench::alloc_totals end = corobench::alloc_snapshot();
+  bytes = static_cast<double>(end.bytes - start.bytes) / timers;
+#endif
+  state.counters["bytes/timer"] = bytes;
+}
+
+template <typename Task>
+static Task timer_sleeper(corobench::timing_wheel &wheel, std::uint64_t delay,
+                          std::int64_t &fired) {
+  // Not awaited inside the if condition: GCC 12 traps when a frame
+  // suspended there is destroyed
+  bool expired = co_await wheel.sleep_for(std::chrono::milliseconds(delay));
+  if (expired) {
+    ++fired;
+  }
+  co_return 0;
+}
+
+// Each pending timer is one suspended coroutine; its cost is the frame
+template <typename Task>
+static void run_timers_coroutine(benchmark::State &state, timer_phase phase) {
+  const std::int64_t count = state.range(0);
+  corobench::timing_wheel wheel;
+  std::vector<Task> tasks;
+  tasks.reserve(static_cast<std::size_t>(count));
+  std::int64_t fired = 0;
+
+  run_timers(
+      state, phase, wheel, 0,
+      [&] {
+        for (std::int64_t i = 0; i < count; ++i) {
+          tasks.push_back(timer_sleeper<Task>(wheel, timer_delay(i), fired));
+        }
+      },
+      // Destroying a sleeping coroutine unlinks its timer
+      [&] { tasks.clear(); }, [&] { tasks.clear(); });
+
+  benchmark::DoNotOptimize(fired);
+}
+
+// Each pending timer is one node holding a std::function, as in the
+// callback style
+static void run_timers_callback(benchmark::State &state, timer_phase phase) {
+  using callback = std::function<void()>;
+  const std::int64_t count = state.range(0);
+  corobench::timing_wheel wheel;
+  std::vector<corobench::timer_node *> timers;
+  timers.reserve(static_cast<std::size_t>(count));
+  std::int64_t fired = 0;
+
+  run_timers(
+      state, phase, wheel, corobench::timing_wheel::callback_size<callback>(),
+      [&] {
+        for (std::int64_t i = 0; i < count; ++i) {
+          timers.push_back(wheel.schedule_after(
+              std::chrono::milliseconds(timer_delay(i)),
+              callback([&fired] { ++fired; })));
+        }
+      },
+      [&] {
+        for (corobench::timer_node *timer : timers) {
+          wheel.cancel(timer);
+        }
+      },
+      // Expired and cancelled nodes free themselves
+      [&] { timers.clear(); });
+
+  benchmark::DoNotOptimize(fired);
+}
+
+static void BM_TimerInsert_Callback(benchmark::State &state) {
+  run_timers_callback(state, timer_phase::insert);
+}
+BENCHMARK(BM_TimerInsert_Callback)
+    ->RangeMultiplier(10)
+    ->Range(10'000, 10'000'000)
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_TimerInsert_Coroutine(benchmark::State &state) {
+  run_timers_coroutine<async_coro::task<int>>(state, timer_phase::insert);
+}
+BENCHMARK(BM_TimerInsert_Coroutine)
+    ->RangeMultiplier(10)
+    ->Range(10'000, 10'000'000)
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_TimerInsert_CoroOptimized(benchmark::State &state) {
+  run_timers_coroutine<async_coro_opt::task<int>>(state, timer_phase::insert);
+}
+BENCHMARK(BM_TimerInsert_CoroOptimized)
+    ->RangeMultiplier(10)
+    ->Range(10'000, 10'000'000)
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_TimerCancel_Callback(benchmark::State &state) {
+  run_timers_callback(state, timer_phase::cancel);
+}
+BENCHMARK(BM_TimerCancel_Callback)
+    ->RangeMultiplier(10)
+    ->Range(10'000, 10'000'000)
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_TimerCancel_Coroutine(benchmark::State &state) {
+  run_timers_coroutine<async_coro::task<int>>(state, timer_phase::cancel);
+}
+BENCHMARK(BM_TimerCancel_Coroutine)
+    ->RangeMultiplier(10)
+    ->Range(10'000, 10'000'000)
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_TimerCancel_CoroOptimized(benchmark::State &state) {
+  run_timers_coroutine<async_coro_opt::task<int>>(state, timer_phase::cancel);
+}
+BENCHMARK(BM_TimerCancel_CoroOptimized)
+    ->RangeMultiplier(10)
+    ->Range(10'000, 10'000'000)
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_TimerExpire_Callback(benchmark::State &state) {
+  run_timers_callback(state, timer_phase::expire);
+}
+BENCHMARK(BM_TimerExpire_Callback)
+    ->RangeMultiplier(10)
+    ->Range(10'000, 10'000'000)
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_TimerExpire_Coroutine(benchmark::State &state) {
+  run_timers_coroutine<async_coro::task<int>>(state, timer_phase::expire);
+}
+BENCHMARK(BM_TimerExpire_Coroutine)
+    ->RangeMultiplier(10)
+    ->Range(10'000, 10'000'000)
+    ->Unit(benchmark::kMillisecond);
+
+static void BM_TimerExpire_CoroOptimized(benchmark::State &state) {
+  run_timers_coroutine<async_coro_opt::task<int>>(state, timer_phase::expire);
+}
+BENCHMARK(BM_TimerExpire_CoroOptimized)
+    ->RangeMultiplier(10)
+    ->Range(10'000, 10'000'000)
+    ->Unit(benchmark::kMillisecond);
+
+// ============================================================================
+// NUMA PLACEMENT - Pinned vs unpinned workers, node-local vs interleaved frames
+// ============================================================================
+
+// Every allowed CPU runs a worker. A root task fans out 256 async_chain tasks
+// whose frames come from numa_frame_pool. pinned=1 uses the placement
+// constructor (workers pinned node by node, same-node stealing first);
+// interleaved=1 makes every worker draw frames from the interleaved arena
+// instead of its own node's. On a single-node machine all four variants
+// place memory identically and only the pinning differs.
+//
+// async_fan_out creates all 256 async_chain frames, and the first
+// async_compute frame of each, on the one worker that runs the root, so
+// those come from that worker's arena whichever worker later steals them.
+// Only the frames created after a steal are local to the thief.
+static void BM_NumaFanOut_CoroAtomic(benchmark::State &state) {
+  constexpr int tasks = 256;
+  const auto &topology = corobench::numa_topology::system();
+  std::size_t workers = std::max<std::size_t>(1, topology.cpus_by_node().size());
+
+  // Workers pick their arena on their first allocation, so set the policy
+  // before any of them starts
+  corobench::numa_frame_pool::set_interleaved(state.range(1) != 0);
+  std::unique_ptr<corobench::work_stealing_pool> pool;
+  if (state.range(0) != 0) {
+    pool = std::make_unique<corobench::work_stealing_pool>(workers, topology);
+  } else {
+    pool = std::make_unique<corobench::work_stealing_pool>(workers);
+  }
+
+  {
+    // Closed before the pool is torn down, so its frees are not counted
+    corobench::scoped_counters counters(state);
+    for (auto _ : state) {
+      auto task = async_coro_numa::async_fan_out(*pool, tasks, 1000);
+      int result = task.get();
+      benchmark::DoNotOptimize(result);
+    }
+  }
+  pool.reset();
+  corobench::numa_frame_pool::set_interleaved(false);
+
+  state.SetItemsProcessed(state.iterations() * tasks);
+  state.counters["nodes"] = static_cast<double>(topology.nodes().size());
+}
+BENCHMARK(BM_NumaFanOut_CoroAtomic)
+    ->ArgsProduct({{0, 1}, {0, 1}})
+    ->ArgNames({"pinned", "interleaved"})
+    ->UseRealTime();
+
+// ============================================================================
+// PRIORITY - High-priority latency under a saturating low-priority backlog
+// ============================================================================
+
+// Two workers are kept busy by 64 loops of async_compute(1000) queued at the
+// lowest level. Each iteration queues one probe and reports the p50/p99 time
+// until a worker starts it. The probe is queued with mode 0 (fifo) at the
+// backlog's level, with mode 1 (priority) at the highest level, or with
+// mode 2 (deadline) by schedule_by(now + 100us).
+static constexpr int priority_backlog = 64;
+static constexpr auto probe_budget = std::chrono::microseconds(100);
+
+static async_coro_atomic::task<int>
+keep_busy(corobench::priority_scheduler &scheduler,
+          const std::atomic<bool> &stop) {
+  unsigned sum = 0;
+  while (!stop.load(std::memory_order_relaxed)) {
+    int val = co_await async_coro_atomic::async_compute(scheduler, 1000);
+    sum += static_cast<unsigned>(val);
+  }
+  co_return static_cast<int>(sum);
+}
+
+static corobench::priority_scheduler::schedule_awaiter
+probe_schedule(corobench::priority_scheduler &scheduler, int mode,
+               corobench::priority_scheduler::clock::time_point start) {
+  switch (mode) {
+  case 0:
+    return scheduler.schedule(corobench::priority_scheduler::lowest);
+  case 1:
+    return scheduler.schedule(corobench::priority_scheduler::highest);
+  default:
+    return scheduler.schedule_by(start + probe_budget);
+  }
+}
+
+static async_coro_atomic::task<int>
+probe(corobench::priority_scheduler &scheduler, int mode,
+      std::int64_t &latency) {
+  using clock = corobench::priority_scheduler::clock;
+  auto start = clock::now();
+  co_await probe_schedule(scheduler, mode, start);
+  auto elapsed = clock::now() - start;
+  latency =
+      std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
+  co_return 0;
+}
+
+// Callback backlog loop: computes on a worker, then re-posts itself
+struct busy_callback {
+  corobench::priority_scheduler *scheduler;
+  const std::atomic<bool> *stop;
+  std::atomic<int> *running;
+
+  void operator()() const {
+    async_callback::async_compute<int>(
+        *scheduler, 1000, [self = *this](int val) {
+          benchmark::DoNotOptimize(val);
+          if (self.stop->load(std::memory_order_relaxed)) {
+            self.running->fetch_sub(1, std::memory_order_release);
+          } else {
+            self();
+          }
+        });
+  }
+};
+
+template <typename Post>
+static void post_probe(corobench::priority_scheduler &scheduler, int mode,
+                       corobench::priority_scheduler::clock::time_point start,
+                       Post &&fn) {
+  switch (mode) {
+  case 0:
+    scheduler.post(corobench::priority_scheduler::lowest,
+                   std::forward<Post>(fn));
+    break;
+  case 1:
+    scheduler.post(corobench::priority_scheduler::highest,
+                   std::forward<Post>(fn));
+    break;
+  default:
+    scheduler.post_by(start + probe_budget, std::forward<Post>(fn));
+    break;
+  }
+}
+
+static void BM_PriorityProbe_Callback(benchmark::State &state) {
+  using clock = corobench::priority_scheduler::clock;
+  const int mode = static_cast<int>(state.range(0));
+  std::vector<std::int64_t> samples;
+  samples.reserve(1 << 20);
+  {
+    corobench::priority_scheduler scheduler(2);
+    std::atomic<bool> stop{false};
+    std::atomic<int> running{priority_backlog};
+    for (int i = 0; i < priority_backlog; ++i) {
+      busy_callback{&scheduler, &stop, &running}();
+    }
+
+    {
+      // Process-wide, so the backlog's own allocations are included
+      corobench::scoped_counters counters(state);
+      for (auto _ : state) {
+        std::int64_t latency = 0;
+        std::atomic<bool> done{false};
+        auto start = clock::now();
+        post_probe(scheduler, mode, start, [&latency, &done, start] {
+          latency = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                        clock::now() - start)
+                        .count();
+          done.store(true, std::memory_order_release);
+        });
+        while (!done.load(std::memory_order_acquire)) {
+          std::this_thread::yield();
+        }
+        samples.push_back(latency);
+      }
+    }
+
+    stop.store(true, std::memory_order_relaxed);
+    while (running.load(std::memory_order_acquire) != 0) {
+      std::this_thread::yield();
+    }
+  }
+  report_percentiles(state, samples);
+}
+BENCHMARK(BM_PriorityProbe_Callback)
+    ->ArgName("mode")
+    ->DenseRange(0, 2)
+    ->UseRealTime();
+
+static void BM_PriorityProbe_CoroAtomic(benchmark::State &state) {
+  const int mode = static_cast<int>(state.range(0));
+  std::vector<std::int64_t> samples;
+  samples.reserve(1 << 20);
+  {
+    corobench::priority_scheduler scheduler(2);
+    std::atomic<bool> stop{false};
+    std::vector<async_coro_atomic::task<int>> backlog;
+    for (int i = 0; i < priority_backlog; ++i) {
+      backlog.push_back(keep_busy(scheduler, stop));
+    }
+
+    {
+      // Process-wide, so the backlog's own allocations are included
+      corobench::scoped_counters counters(state);
+      for (auto _ : state) {
+        std::int64_t latency = 0;
+        auto task = probe(scheduler, mode, latency);
+        task.get();
+        samples.push_back(latency);
+      }
+    }
+
+    stop.store(true, std::memory_order_relaxed);
+    for (auto &task : backlog) {
+      task.get();
+    }
+  }
+  report_percentiles(state, samples);
+}
+BENCHMARK(BM_PriorityProbe_CoroAtomic)
+    ->ArgName("mode")
+    ->DenseRange(0, 2)
+    ->UseRealTime();
+
+// ============================================================================
+// PREFETCHED RESUME - Draining a million ready coroutines with cold frames
+// ============================================================================
+
+// Each iteration parks 1M async_compute-style coroutines, queues their
+// handles in an order unrelated to allocation order (as when completions
+// arrive from I/O) and times one drain of the resume_queue. Plain resumes
+// handle by handle; Prefetch issues the frame prefetches `batch` handles
+// ahead.
+static constexpr std::size_t resume_count = 1'000'000;
+
+// Parks the awaiting coroutine in a slot chosen by the benchmark
+struct park_awaiter {
+  std::coroutine_handle<> *slot;
+
+  bool await_ready() const noexcept { return false; }
+
+  void await_suspend(std::coroutine_handle<> h) noexcept { *slot = h; }
+
+  void await_resume() const noexcept {}
+};
+
+static async_coro_opt::task<int> parked_compute(std::coroutine_handle<> *slot,
+                                                int x) {
+  co_await park_awaiter{slot};
+  volatile int result = 0;
+  for (int i = 0; i < x; i = i + 1) {
+    volatile int temp = i * 31 + (i & 1);
+    result += temp;
+  }
+  co_return static_cast<int>(result);
+}
+
+template <typename Drain>
+static void run_resume_drain(benchmark::State &state, Drain drain) {
+  std::vector<std::size_t> order(resume_count);
+  std::iota(order.begin(), order.end(), std::size_t{0});
+  std::shuffle(order.begin(), order.end(), std::mt19937_64(42));
+
+  std::vector<std::coroutine_handle<>> slots(resume_count);
+  std::vector<async_coro_opt::task<int>> tasks;
+  tasks.reserve(resume_count);
+  corobench::resume_queue queue;
+
+  // Counts the untimed parking too: 1M frames per iteration
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    state.PauseTiming();
+    tasks.clear();
+    for (std::size_t i = 0; i < resume_count; ++i) {
+      tasks.push_back(parked_compute(&slots[order[i]], 16));
+    }
+    for (std::coroutine_handle<> h : slots) {
+      queue.push(h);
+    }
+    state.ResumeTiming();
+
+    std::size_t resumed = drain(queue);
+    benchmark::DoNotOptimize(resumed);
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<std::int64_t>(resume_count));
+}
+
+static void BM_ResumeDrain_Plain(benchmark::State &state) {
+  run_resume_drain(state, [](auto &queue) { return queue.drain(); });
+}
+BENCHMARK(BM_ResumeDrain_Plain)->Unit(benchmark::kMillisecond);
+
+static void BM_ResumeDrain_Prefetch(benchmark::State &state) {
+  auto batch = static_cast<std::size_t>(state.range(0));
+  run_resume_drain(state, [batch](auto &queue) {
+    return queue.drain_prefetched(batch);
+  });
+}
+BENCHMARK(BM_ResumeDrain_Prefetch)
+    ->ArgName("batch")
+    ->RangeMultiplier(2)
+    ->Range(1, 64)
+    ->Unit(benchmark::kMillisecond);
+
+// ============================================================================
+// WHEN_ALL - Joining N async_compute children running on a two-worker pool
+// ============================================================================
+
+// Every child hops onto the pool and computes async_compute(1000); the
+// caller joins all of them and sums the results. Callback uses a countdown
+// latch in one shared allocation. CoroAtomic awaits when_all over a vector
+// of tasks, CoroAtomicVariadic awaits when_all(task, task, ...) and gets a
+// tuple back.
+
+template <typename Scheduler>
+static async_coro_atomic::task<int> when_all_range(Scheduler &scheduler,
+                                                   int count, int x) {
+  std::vector<async_coro_atomic::task<int>> children;
+  children.reserve(static_cast<std::size_t>(count));
+  for (int i = 0; i < count; ++i) {
+    children.push_back(async_coro_atomic::async_compute(scheduler, x));
+  }
+  co_await async_coro_atomic::when_all(children);
+  unsigned sum = 0;
+  for (auto &child : children) {
+    sum += static_cast<unsigned>(child.get());
+  }
+  co_return static_cast<int>(sum);
+}
+
+template <typename Scheduler, std::size_t... I>
+static async_coro_atomic::task<int>
+when_all_variadic(Scheduler &scheduler, int x, std::index_sequence<I...>) {
+  auto results = co_await async_coro_atomic::when_all(
+      ((void)I, async_coro_atomic::async_compute(scheduler, x))...);
+  co_return std::apply(
+      [](auto... val) {
+        return static_cast<int>((0u + ... + static_cast<unsigned>(val)));
+      },
+      results);
+}
+
+static void BM_WhenAll_Callback(benchmark::State &state) {
+  const int count = static_cast<int>(state.range(0));
+  corobench::callback_pool pool(2);
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    int result = 0;
+    std::atomic<bool> done{false};
+    async_callback::async_fan_out<int>(pool, count, 1000, [&](int val) {
+      result = val;
+      done.store(true, std::memory_order_release);
+    });
+    while (!done.load(std::memory_order_acquire)) {
+      std::this_thread::yield();
+    }
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_WhenAll_Callback)
+    ->Arg(2)
+    ->Arg(8)
+    ->Arg(64)
+    ->Arg(1024)
+    ->UseRealTime();
+
+static void BM_WhenAll_CoroAtomic(benchmark::State &state) {
+  const int count = static_cast<int>(state.range(0));
+  corobench::work_stealing_pool pool(2);
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    auto task = when_all_range(pool, count, 1000);
+    int result = task.get();
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_WhenAll_CoroAtomic)
+    ->Arg(2)
+    ->Arg(8)
+    ->Arg(64)
+    ->Arg(1024)
+    ->UseRealTime();
+
+template <std::size_t N>
+static void run_when_all_variadic(benchmark::State &state) {
+  corobench::work_stealing_pool pool(2);
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    auto task = when_all_variadic(pool, 1000, std::make_index_sequence<N>{});
+    int result = task.get();
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(N));
+}
+
+static void BM_WhenAll_CoroAtomicVariadic(benchmark::State &state) {
+  switch (state.range(0)) {
+  case 2:
+    run_when_all_variadic<2>(state);
+    break;
+  case 8:
+    run_when_all_variadic<8>(state);
+    break;
+  default:
+    run_when_all_variadic<64>(state);
+    break;
+  }
+}
+// No 1024: a std::tuple of 1024 tasks nests deeper than GCC's default
+// template instantiation depth of 900
+BENCHMARK(BM_WhenAll_CoroAtomicVariadic)
+    ->Arg(2)
+    ->Arg(8)
+    ->Arg(64)
+    ->UseRealTime();
+
+// ============================================================================
+// WHEN_ANY - Racing N async_compute replicas and cancelling the losers
+// ============================================================================
+
+// Replica 0 computes 1000 iterations and the others 1M, all on a two-worker
+// pool, so every loser depends on cancellation to finish quickly. Each
+// iteration lasts until every replica is gone. `first_ns` is the mean time to
+// the first result (first_callback, or the stop request made by when_any's
+// winner). `teardown_ns` is the mean time from there until the losers have
+// unwound.
+
+static std::vector<int> race_workloads(int count) {
+  std::vector<int> workloads(static_cast<std::size_t>(count), 1'000'000);
+  workloads[0] = 1000;
+  return workloads;
+}
+
+template <typename Scheduler>
+static async_coro_atomic::task<int> when_any_race(
+    Scheduler &scheduler, const std::vector<int> &workloads,
+    std::stop_source &stop) {
+  std::vector<async_coro_atomic::task<int>> replicas;
+  replicas.reserve(workloads.size());
+  for (int x : workloads) {
+    replicas.push_back(
+        async_coro_atomic::async_compute(scheduler, x, stop.get_token()));
+  }
+  std::size_t winner = co_await async_coro_atomic::when_any(stop, replicas);
+  co_return winner < replicas.size() ? replicas[winner].get() : 0;
+}
+
+static void report_race(benchmark::State &state, std::int64_t first_ns,
+                        std::int64_t total_ns) {
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+  state.counters["first_ns"] = benchmark::Counter(
+      static_cast<double>(first_ns), benchmark::Counter::kAvgIterations);
+  state.counters["teardown_ns"] =
+      benchmark::Counter(static_cast<double>(total_ns - first_ns),
+                         benchmark::Counter::kAvgIterations);
+}
+
+static void BM_WhenAny_Callback(benchmark::State &state) {
+  using clock = std::chrono::steady_clock;
+  const auto workloads = race_workloads(static_cast<int>(state.range(0)));
+  corobench::callback_pool pool(2);
+  std::int64_t first_ns = 0;
+  std::int64_t total_ns = 0;
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    int result = 0;
+    std::atomic<bool> done{false};
+    auto start = clock::now();
+    clock::time_point first;
+    async_callback::async_when_any<int>(
+        pool, workloads,
+        [&](int val) {
+          first = clock::now();
+          result = val;
+        },
+        [&] { done.store(true, std::memory_order_release); });
+    while (!done.load(std::memory_order_acquire)) {
+      std::this_thread::yield();
+    }
+    auto end = clock::now();
+    first_ns +=
+        std::chrono::duration_cast<std::chrono::nanoseconds>(first - start)
+            .count();
+    total_ns +=
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+            .count();
+    benchmark::DoNotOptimize(result);
+  }
+  report_race(state, first_ns, total_ns);
+}
+BENCHMARK(BM_WhenAny_Callback)
+    ->Arg(2)
+    ->Arg(8)
+    ->Arg(64)
+    ->Arg(1024)
+    ->UseRealTime();
+
+static void BM_WhenAny_CoroAtomic(benchmark::State &state) {
+  using clock = std::chrono::steady_clock;
+  const auto workloads = race_workloads(static_cast<int>(state.range(0)));
+  corobench::work_stealing_pool pool(2);
+  std::int64_t first_ns = 0;
+  std::int64_t total_ns = 0;
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    std::stop_source stop;
+    clock::time_point first;
+    // Runs inside the winner's request_stop()
+    std::stop_callback on_first(stop.get_token(),
+                                [&first] { first = clock::now(); });
+    auto start = clock::now();
+    auto task = when_any_race(pool, workloads, stop);
+    int result = task.get();
+    auto end = clock::now();
+    first_ns +=
+        std::chrono::duration_cast<std::chrono::nanoseconds>(first - start)
+            .count();
+    total_ns +=
+        std::chrono::duration_cast<std::chrono::nanoseconds>(end - start)
+            .count();
+    benchmark::DoNotOptimize(result);
+  }
+  report_race(state, first_ns, total_ns);
+}
+BENCHMARK(BM_WhenAny_CoroAtomic)
+    ->Arg(2)
+    ->Arg(8)
+    ->Arg(64)
+    ->Arg(1024)
+    ->UseRealTime();
+
+// ============================================================================
+// ASYNC SCOPE - Fire-and-forget spawning joined by one counter
+// ============================================================================
+
+// Each iteration spawns N detached async_compute(100) jobs onto a two-worker
+// pool from the benchmark thread, then joins the scope. items_per_second is
+// the spawn-and-complete rate. peak_tasks is the most jobs alive at once, as
+// seen after each spawn. peak_bytes estimates the memory behind them as
+// peak_tasks x bytes/task, the frame size for coroutines and the posted node
+// for callbacks. Where the allocation hooks track live bytes, peak_bytes is
+// instead the measured high-water mark above what was live before the first
+// iteration, on every thread.
+
+class scope_memory {
+public:
+  explicit scope_memory(benchmark::State &state) noexcept : state(state) {
+#ifdef COROBENCH_TRACK_PEAK_BYTES
+    base = corobench::alloc_live_bytes();
+    corobench::reset_alloc_peak();
+#endif
+  }
+
+  scope_memory(const scope_memory &) = delete;
+  scope_memory &operator=(const scope_memory &) = delete;
+
+  void report(std::size_t peak_tasks, std::size_t bytes_per_task) {
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.counters["peak_tasks"] = static_cast<double>(peak_tasks);
+    state.counters["bytes/task"] = static_cast<double>(bytes_per_task);
+    double peak_bytes = static_cast<double>(peak_tasks * bytes_per_task);
+#ifdef COROBENCH_TRACK_PEAK_BYTES
+    peak_bytes = static_cast<double>(corobench::alloc_peak_bytes() - base);
+#endif
+    state.counters["peak_bytes"] = peak_bytes;
+  }
+
+private:
+  benchmark::State &state;
+#ifdef COROBENCH_TRACK_PEAK_BYTES
+  std::uint64_t base = 0;
+#endif
+};
+
+template <typename Scheduler>
+static async_coro_atomic::task<int>
+spawn_and_join(Scheduler &scheduler, async_coro_atomic::async_scope &scope,
+               int count, std::size_t &peak) {
+  for (int i = 0; i < count; ++i) {
+    scope.spawn(async_coro_atomic::async_compute(scheduler, 100));
+    peak = std::max(peak, scope.size());
+  }
+  co_await scope.join();
+  co_return count;
+}
+
+static void BM_ScopeSpawn_Callback(benchmark::State &state) {
+  const int count = static_cast<int>(state.range(0));
+  corobench::callback_pool pool(2);
+  async_callback::async_scope scope;
+  auto work = [] {
+    async_callback::async_compute<int>(
+        100, [](int val) { benchmark::DoNotOptimize(val); });
+  };
+  std::size_t peak = 0;
+  corobench::scoped_counters counters(state);
+  scope_memory memory(state);
+  for (auto _ : state) {
+    std::atomic<bool> done{false};
+    for (int i = 0; i < count; ++i) {
+      scope.spawn(pool, work);
+      peak = std::max(peak, scope.size());
+    }
+    scope.join([&] { done.store(true, std::memory_order_release); });
+    while (!done.load(std::memory_order_acquire)) {
+      std::this_thread::yield();
+    }
+  }
+  memory.report(peak, corobench::callback_pool::post_size<
+                          async_callback::async_scope::job<decltype(work)>>());
+}
+BENCHMARK(BM_ScopeSpawn_Callback)
+    ->Arg(1'000)
+    ->Arg(10'000)
+    ->Arg(100'000)
+    ->UseRealTime();
+
+static void BM_ScopeSpawn_CoroAtomic(benchmark::State &state) {
+  const int count = static_cast<int>(state.range(0));
+  corobench::work_stealing_pool pool(2);
+  async_coro_atomic::async_scope scope;
+
+  // Frame size of one job, measured on a job outside the scope
+  corobench::frame_stats::totals before = corobench::frame_stats::snapshot();
+  {
+    auto probe = async_coro_atomic::async_compute(pool, 100);
+    benchmark::DoNotOptimize(probe.get());
+  }
+  auto bytes_per_task = static_cast<std::size_t>(
+      corobench::frame_stats::snapshot().bytes - before.bytes);
+
+  std::size_t peak = 0;
+  corobench::scoped_counters counters(state);
+  scope_memory memory(state);
+  for (auto _ : state) {
+    auto task = spawn_and_join(pool, scope, count, peak);
+    int spawned = task.get();
+    benchmark::DoNotOptimize(spawned);
+  }
+  memory.report(peak, bytes_per_task);
+}
+BENCHMARK(BM_ScopeSpawn_CoroAtomic)
+    ->Arg(1'000)
+    ->Arg(10'000)
+    ->Arg(100'000)
+    ->UseRealTime();
+
+// ============================================================================
+// STOP TOKENS - Cost of carrying a stop token, and stop-to-unwind latency
+// ============================================================================
+
+// `depth` nested co_awaits down to one Compute(x)
+template <typename Task, Task (*Compute)(int)>
+static Task deep_chain(int depth, int x) {
+  if (depth == 0) {
+    int leaf = co_await Compute(x);
+    co_return leaf;
+  }
+  int val = co_await deep_chain<Task, Compute>(depth - 1, x);
+  co_return val + 1;
+}
+
+// A 64-deep chain over async_compute(1), so the time is almost all co_await
+// overhead; items_per_second counts co_awaits. CoroStoppable starts with a
+// live token, which every level inherits and the leaf checks per iteration.
+static constexpr int stop_chain_depth = 64;
+
+template <typename Task, Task (*Compute)(int), typename Start>
+static void run_stop_chain(benchmark::State &state, Start start) {
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    auto task = deep_chain<Task, Compute>(stop_chain_depth, 1);
+    start(task);
+    int result = task.get();
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetItemsProcessed(state.iterations() * (stop_chain_depth + 1));
+}
+
+static void BM_StopChain_CoroOptimized(benchmark::State &state) {
+  run_stop_chain<async_coro_opt::task<int>, &async_coro_opt::async_compute>(
+      state, [](auto &) {});
+}
+BENCHMARK(BM_StopChain_CoroOptimized);
+
+static void BM_StopChain_CoroLazy(benchmark::State &state) {
+  run_stop_chain<async_coro_lazy::task<int>, &async_coro_lazy::async_compute>(
+      state, [](auto &task) { task.start(); });
+}
+BENCHMARK(BM_StopChain_CoroLazy);
+
+static void BM_StopChain_CoroStoppable(benchmark::State &state) {
+  std::stop_source source;
+  std::stop_token token = source.get_token();
+  run_stop_chain<async_coro_stoppable::task<int>,
+                 &async_coro_stoppable::async_compute>(
+      state, [&token](auto &task) { task.start(token); });
+}
+BENCHMARK(BM_StopChain_CoroStoppable);
+
+// A chain of `depth` levels runs on its own thread, its leaf spinning on the
+// inherited token. Each iteration times request_stop() until the root has
+// returned and reports the p50/p99. frames/iter sees only the root, since the
+// other levels are created on the runner thread; the heap counters, which
+// also include the thread itself, see every level.
+static std::atomic<bool> leaf_spinning{false};
+
+static async_coro_stoppable::task<int> spin_until_stopped(int) {
+  const std::stop_token &stop =
+      co_await async_coro_stoppable::get_stop_token;
+  leaf_spinning.store(true, std::memory_order_release);
+  unsigned spins = 0;
+  while (!stop.stop_requested()) {
+    ++spins;
+  }
+  co_return static_cast<int>(spins);
+}
+
+static void BM_StopUnwind_CoroStoppable(benchmark::State &state) {
+  using clock = std::chrono::steady_clock;
+  const int depth = static_cast<int>(state.range(0));
+  std::vector<std::int64_t> samples;
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    std::stop_source source;
+    std::stop_token token = source.get_token();
+    auto task = deep_chain<async_coro_stoppable::task<int>,
+                           &spin_until_stopped>(depth, 0);
+    std::atomic<bool> finished{false};
+    leaf_spinning.store(false, std::memory_order_relaxed);
+    std::thread runner([&] {
+      task.start(token);
+      finished.store(true, std::memory_order_release);
+    });
+    while (!leaf_spinning.load(std::memory_order_acquire)) {
+      std::this_thread::yield();
+    }
+
+    auto start = clock::now();
+    source.request_stop();
+    while (!finished.load(std::memory_order_acquire)) {
+      std::this_thread::yield();
+    }
+    auto elapsed = clock::now() - start;
+    samples.push_back(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+
+    runner.join();
+    benchmark::DoNotOptimize(task.get());
+  }
+  report_percentiles(state, samples);
+}
+BENCHMARK(BM_StopUnwind_CoroStoppable)
+    ->ArgName("depth")
+    ->Arg(1)
+    ->Arg(16)
+    ->Arg(256)
+    ->Arg(4096)
+    ->UseRealTime();
+
+// ============================================================================
+// STREAMING - 10M items through a generator or a per-item callback
+// ============================================================================
+
+// Each iteration streams 0..10M-1 and sums it. Callback makes one
+// std::function call per item. Generator yields item by item and the consumer
+// pulls with co_await next(). GeneratorBatched yields spans of `batch` items,
+// so only one next() per batch suspends.
+static constexpr int stream_items = 10'000'000;
+
+static async_coro_lazy::task<int>
+consume_stream(async_coro_lazy::async_generator<int> stream) {
+  unsigned sum = 0;
+  for (;;) {
+    const int *item = co_await stream.next();
+    if (!item) {
+      break;
+    }
+    sum += static_cast<unsigned>(*item);
+  }
+  co_return static_cast<int>(sum);
+}
+
+static void BM_Stream_Callback(benchmark::State &state) {
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    unsigned sum = 0;
+    bool done = false;
+    async_callback::async_stream<int>(
+        stream_items, [&sum](int item) { sum += static_cast<unsigned>(item); },
+        [&done] { done = true; });
+    benchmark::DoNotOptimize(sum);
+    benchmark::DoNotOptimize(done);
+  }
+  state.SetItemsProcessed(state.iterations() * stream_items);
+}
+BENCHMARK(BM_Stream_Callback)->Unit(benchmark::kMillisecond);
+
+static void BM_Stream_Generator(benchmark::State &state) {
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    auto task = consume_stream(async_coro_lazy::async_stream(stream_items));
+    task.start();
+    int result = task.get();
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetItemsProcessed(state.iterations() * stream_items);
+}
+BENCHMARK(BM_Stream_Generator)->Unit(benchmark::kMillisecond);
+
+static void BM_Stream_GeneratorBatched(benchmark::State &state) {
+  const int batch = static_cast<int>(state.range(0));
+  corobench::scoped_counters counters(state);
+  for (auto _ : state) {
+    auto task =
+        consume_stream(async_coro_lazy::async_stream(stream_items, batch));
+    task.start();
+    int result = task.get();
+    benchmark::DoNotOptimize(result);
+  }
+  state.SetItemsProcessed(state.iterations() * stream_items);
+}
+BENCHMARK(BM_Stream_GeneratorBatched)
+    ->ArgName("batch")
+    ->RangeMultiplier(4)
+    ->Range(1, 1024)
+    ->Unit(benchmark::kMillisecond);
+
+// ============================================================================
+// FRAME REPORT - Frame size per coroutine, printed by --frame-report
+// ============================================================================
+
+template <typename MakeTask>
+static void report_frame(const char *implementation, const char *function,
+                         MakeTask make_task) {
+  std::vector<std::size_t> sizes;
+  {
+    corobench::frame_stats::trace trace(sizes);
+    auto task = make_task();
+    if constexpr (requires { task.start(); }) {
+      task.start();
+    }
+    int result = task.get();
+    benchmark::DoNotOptimize(result);
+  }
+  std::size_t own = sizes.empty() ? 0 : sizes.front();
+  std::size_t total = std::accumulate(sizes.begin(), sizes.end(),
+                                      std::size_t{0});
+  std::printf("%-18s %-22s %10zu %8zu %12zu\n", implementation, function, own,
+              sizes.size(), total);
+}
+
+template <typename Compute, typename Chain, typename ComplexChain>
+static void report_frames(const char *implementation, Compute compute,
+                          Chain chain, ComplexChain complex_chain) {
+  report_frame(implementation, "async_compute", compute);
+  report_frame(implementation, "async_chain", chain);
+  report_frame(implementation, "async_complex_chain", complex_chain);
+}
+
+static void print_frame_report() {
+#if defined(__clang__)
+  std::printf("Compiler: Clang %s\n", __clang_version__);
+#elif defined(__GNUC__)
+  std::printf("Compiler: GCC %s\n", __VERSION__);
+#else
+  std::printf("Compiler: unknown\n");
+#endif
+  std::printf("Frame bytes: size requested for the coroutine's own frame\n");
+  std::printf("Frames/Total: every heap frame created by one call\n\n");
+  std::printf("%-18s %-22s %10s %8s %12s\n", "Implementation", "Function",
+              "Frame", "Frames", "Total bytes");
+
+  report_frames(
+      "Coroutine", [] { return async_coro::async_compute(1000); },
+      [] { return async_coro::async_chain(1000); },
+      [] { return async_coro::async_complex_chain(1000); });
+  report_frames(
+      "CoroOptimized", [] { return async_coro_opt::async_compute(1000); },
+      [] { return async_coro_opt::async_chain(1000); },
+      [] { return async_coro_opt::async_complex_chain(1000); });
+  report_frames(
+      "CoroPooled", [] { return async_coro_pooled::async_compute(1000); },
+      [] { return async_coro_pooled::async_chain(1000); },
+      [] { return async_coro_pooled::async_complex_chain(1000); });
+  report_frames(
+      "CoroArena",
+      [] {
+        return async_coro_arena::async_compute(
+            std::allocator_arg, std::allocator<std::byte>{}, 1000);
+      },
+      [] {
+        return async_coro_arena::async_chain(std::allocator_arg,
+                                             std::allocator<std::byte>{}, 1000);
+      },
+      [] {
+        return async_coro_arena::async_complex_chain(
+            std::allocator_arg, std::allocator<std::byte>{}, 1000);
+      });
+  report_frames(
+      "CoroPmr", [] { return async_coro_pmr::async_compute(1000); },
+      [] { return async_coro_pmr::async_chain(1000); },
+      [] { return async_coro_pmr::async_complex_chain(1000); });
+  report_frames(
+      "CoroAtomic", [] { return async_coro_atomic::async_compute(1000); },
+      [] { return async_coro_atomic::async_chain(1000); },
+      [] { return async_coro_atomic::async_complex_chain(1000); });
+  report_frames(
+      "CoroNuma", [] { return async_coro_numa::async_compute(1000); },
+      [] { return async_coro_numa::async_chain(1000); },
+      [] { return async_coro_numa::async_complex_chain(1000); });
+  report_frames(
+      "CoroLazy", [] { return async_coro_lazy::async_compute(1000); },
+      [] { return async_coro_lazy::async_chain(1000); },
+      [] { return async_coro_lazy::async_complex_chain(1000); });
+  report_frames(
+      "CoroStoppable",
+      [] { return async_coro_stoppable::async_compute(1000); },
+      [] { return async_coro_stoppable::async_chain(1000); },
+      [] { return async_coro_stoppable::async_complex_chain(1000); });
+  report_frames(
+      "CoroRemote", [] { return async_coro_remote::async_compute(1000); },
+      [] { return async_coro_remote::async_chain(1000); },
+      [] { return async_coro_remote::async_complex_chain(1000); });
+#ifdef ENABLE_ELIDABLE_BENCHMARKS
+  report_frames(
+      "CoroElidable", [] { return async_coro_elidable::async_compute(1000); },
+      [] { return async_coro_elidable::async_chain(1000); },
+      [] { return async_coro_elidable::async_complex_chain(1000); });
+  report_frames(
+      "CoroOptElidable",
+      [] { return async_coro_opt_elidable::async_compute(1000); },
+      [] { return async_coro_opt_elidable::async_chain(1000); },
+      [] { return async_coro_opt_elidable::async_complex_chain(1000); });
+#endif
+}
+
+int main(int argc, char **argv) {
+  for (int i = 1; i < argc; ++i) {
+    if (std::string_view(argv[i]) == "--frame-report") {
+      print_frame_report();
+      return 0;
+    }
+  }
+
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
\ No newline at end of file